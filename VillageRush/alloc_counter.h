@@ -0,0 +1,97 @@
+#ifndef _ALLOC_COUNTER_H_
+#define _ALLOC_COUNTER_H_
+
+/**
+ * @brief ヒープ確保回数の計測クラス
+ *
+ * このクラスは、グローバルな operator new を置き換えて、スレッドごとのヒープ確保の回数を数えます。
+ * ワールドの更新の前後で回数の差を取ることで、定常状態の刻みでヒープ確保が発生していないかを確認します
+ * （GameManager がプロファイラのカウンターに出力し、ベンチマークが結果に出力します）。
+ *
+ * 使用方法:
+ * - AllocCounter::get_num_alloc() で現在のスレッドのこれまでの確保回数を取得
+ * - AllocCounter::Pause のスコープ内の確保は数えない（プロファイラ自身の記録用の確保など）
+ *
+ * 注意事項:
+ * - operator new の置き換えはプログラム全体で一度だけ定義する必要があるため、
+ *   実行ファイルのエントリーポイント（main.cpp など）でのみ ALLOC_COUNTER_IMPLEMENTATION を定義してからインクルードすること
+ * - リリースビルド（NDEBUGが定義されている場合）では置き換えを行わず、get_num_alloc() は常に0を返します
+ */
+
+#include <new>
+#include <cstddef>
+#include <cstdlib>
+
+class AllocCounter
+{
+public:
+	// 現在のスレッドのこれまでのヒープ確保の回数
+	static size_t get_num_alloc()
+	{
+		return num_alloc;
+	}
+
+	// 確保を記録（置き換えた operator new から呼び出す）
+	static void on_alloc()
+	{
+		if (num_pause == 0)
+			num_alloc++;
+	}
+
+	// スコープ内の確保を数えない
+	class Pause
+	{
+	public:
+		Pause()
+		{
+			num_pause++;
+		}
+		~Pause()
+		{
+			num_pause--;
+		}
+
+		Pause(const Pause &) = delete;
+		Pause &operator=(const Pause &) = delete;
+	};
+
+private:
+	static inline thread_local size_t num_alloc = 0;
+	static inline thread_local int num_pause = 0;
+};
+
+// デバッグビルドのエントリーポイントでのみ operator new / delete を置き換える
+// （配列版は既定の実装がこれらを呼び出すため置き換えない）
+#if !defined(NDEBUG) && defined(ALLOC_COUNTER_IMPLEMENTATION)
+void *operator new(std::size_t size)
+{
+	AllocCounter::on_alloc();
+	void *ptr = std::malloc(size > 0 ? size : 1);
+	if (!ptr)
+		throw std::bad_alloc();
+	return ptr;
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+	AllocCounter::on_alloc();
+	return std::malloc(size > 0 ? size : 1);
+}
+
+void operator delete(void *ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept
+{
+	std::free(ptr);
+}
+#endif
+
+#endif // !_ALLOC_COUNTER_H_
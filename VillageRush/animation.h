@@ -2,82 +2,49 @@
 #define _ANIMATION_H_
 
 /**
- * @brief アニメーションクラス
+ * @brief アニメーションクリップと再生クラス
  *
- * このクラスは、ゲーム内のスプライトアニメーションを管理します。
- * フレームの更新、レンダリング、ループ制御、コールバック機能などを提供します。
+ * アニメーションを、共有される読み取り専用の「クリップ」と、オブジェクトごとの小さな「再生位置」に分けて管理します。
  *
- * 主な機能:
- * - フレームごとのアニメーション更新
- * - アニメーションのレンダリング
- * - ループ設定
- * - アニメーション終了時のコールバック
- * - タイマーを使用したフレーム制御
+ * AnimationClip:
+ * - テクスチャ、各フレームのソース矩形、フレーム間隔、ループの有無を保持
+ * - フレームの画像はテクスチャ上の矩形（テクスチャアトラス内のスプライトシート）から切り出す
+ * - スプライトシート（とフレームの並び）ごとに一度だけ作成し、同じ見た目のオブジェクトで共有する
+ *
+ * Animation:
+ * - 再生中のクリップと経過時間のみを保持
+ * - 表示するフレームは経過時間から計算するため、フレームごとのタイマーやコールバックは持たない
+ * - ループしないクリップの再生終了は check_finished() で確認する
+ * - on_render() は現在のフレームを SpriteBatchManager に追加する（描画は呼び出し側の flush() で行われる）
  *
  * このクラスは、ゲーム内の様々なオブジェクト（キャラクター、エフェクトなど）の
  * アニメーション制御に使用されます。
  */
 
-#include "timer.h"
+#include "sprite_batch_manager.h"
+#include "texture_region.h"
 
 #include <vector>
-#include <functional>
 #include <SDL.h>
 
-/*アニメーションのフレーム更新とレンダリングを処理する*/
-class Animation
+/*アニメーションクリップ、テクスチャとフレームのデータを保持する（作成後は読み取り専用）*/
+struct AnimationClip
 {
-public:
-	// コールバックタイプの定義、アニメーション再生終了時にコールバックをトリガーできる
-	typedef std::function<void()> PlayCallback;
-
-public:
-	Animation()
-	{
-		// タイマーをワンショットではなく設定し、継続的に更新されることを示す
-		timer.set_one_shot(false);
-
-		// タイマーのタイムアウト後のコールバック関数を設定し、アニメーションフレームの更新を担当する
-		timer.set_on_timeout(
-			[&]()
-			{
-				// 現在のフレームインデックスをインクリメント
-				idx_frame++;
-
-				// 現在のフレームがフレームリストの長さを超えた場合、ループが必要かどうかをチェック
-				if (idx_frame >= rect_src_list.size())
-				{
-					// ループする場合は最初のフレームに戻り、そうでない場合は最後のフレームを維持
-					idx_frame = is_loop ? 0 : rect_src_list.size() - 1;
-
-					// ループしない場合で終了コールバックが設定されている場合、コールバックをトリガー
-					if (!is_loop && on_finished)
-						on_finished();
-				};
-			});
-	}
-
-	~Animation() = default;
-
-	// アニメーションをリセットし、現在のフレームを0に設定してタイマーを再起動
-	void reset()
-	{
-		timer.restart();
-
-		idx_frame = 0;
-	}
+	SDL_Texture *texture = nullptr;
+	std::vector<SDL_Rect> rect_src_list; // 各フレームのソース矩形リストを格納
+	int width_frame = 0, height_frame = 0; // 各フレームの幅と高さ
+	double interval = 0.1;				   // フレームの間隔（秒）
+	bool is_loop = true;
 
 	// フレームデータを設定し、テクスチャ内の各フレームのソース矩形を計算
+	// regionはアニメーションセット画像のテクスチャ上の矩形（ヘッドレスモードでは空のため、フレーム数のみを設定する）
 	// num_h; num_vはそれぞれフレームアニメーションセット画像の幅と高さを表す
 	// idx_listは各フレームのインデックスを表す
-	void set_frame_data(SDL_Texture *texture, int num_h, int num_v, const std::vector<int> &idx_list)
+	void set_frame_data(const TextureRegion &region, int num_h, int num_v, const std::vector<int> &idx_list)
 	{
-
-		int width_tex, height_tex;
-
-		// アニメーションセットの実際の幅と高さを問い合わせる
-		this->texture = texture;
-		SDL_QueryTexture(texture, nullptr, nullptr, &width_tex, &height_tex);
+		// アニメーションセットの実際の幅と高さ
+		const int width_tex = region.rect.w, height_tex = region.rect.h;
+		this->texture = region.texture;
 
 		// 水平および垂直フレーム数に基づいて各フレームの幅と高さを計算
 		width_frame = width_tex / num_h, height_frame = height_tex / num_v;
@@ -89,9 +56,9 @@ public:
 			int idx = idx_list[i];				   // idxは現在のフレームインデックスを表す
 			SDL_Rect &rect_src = rect_src_list[i]; // 現在のフレームの画像を切り取る
 
-			// アニメーションセット内の各フレームのxとy位置を計算
-			rect_src.x = (idx % num_h) * width_frame;
-			rect_src.y = (idx / num_h) * height_frame;
+			// アニメーションセット内の各フレームのxとy位置を計算（テクスチャ上のアニメーションセットの位置を加える）
+			rect_src.x = region.rect.x + (idx % num_h) * width_frame;
+			rect_src.y = region.rect.y + (idx / num_h) * height_frame;
 			rect_src.w = width_frame, rect_src.h = height_frame;
 		}
 	}
@@ -105,45 +72,94 @@ public:
 	// フレーム更新の時間間隔を設定
 	void set_interval(double interval)
 	{
-		timer.set_wait_time(interval);
+		this->interval = interval;
+	}
+
+	// 最後のフレームの表示が終わるまでの時間
+	double get_duration() const
+	{
+		return interval * rect_src_list.size();
+	}
+
+	// 経過時間に対応するフレームのインデックス（ループしない場合は最後のフレームで止まる）
+	size_t get_idx_frame(double pass_time) const
+	{
+		if (rect_src_list.empty() || interval <= 0)
+			return 0;
+
+		const size_t idx_frame = (size_t)(pass_time / interval);
+		if (is_loop)
+			return idx_frame % rect_src_list.size();
+		return idx_frame < rect_src_list.size() ? idx_frame : rect_src_list.size() - 1;
+	}
+};
+
+/*アニメーションの再生位置、クリップを参照して現在のフレームをレンダリングする*/
+class Animation
+{
+public:
+	Animation() = default;
+	~Animation() = default;
+
+	// クリップを最初から再生
+	void play(const AnimationClip *clip)
+	{
+		this->clip = clip;
+		reset();
 	}
 
-	// アニメーション終了時のコールバック関数を設定
-	void set_on_finished(PlayCallback on_finished)
+	// 経過時間を保ったままクリップを切り替え（向きの変更など、同じ長さのクリップ間の切り替えに使用）
+	void set_clip(const AnimationClip *clip)
 	{
-		this->on_finished = on_finished;
+		this->clip = clip;
 	}
 
-	// アップデート関数、時間増分を渡してタイマーを更新
+	const AnimationClip *get_clip() const
+	{
+		return clip;
+	}
+
+	// 経過時間をリセットし、最初のフレームに戻す
+	void reset()
+	{
+		pass_time = 0;
+		is_finished = false;
+	}
+
+	// ループしないクリップの再生が終了したかどうか
+	bool check_finished() const
+	{
+		return is_finished;
+	}
+
+	// アップデート関数、時間増分を渡して経過時間を更新
 	void on_update(double delta)
 	{
-		timer.on_update(delta);
+		pass_time += delta;
+
+		if (clip && !clip->is_loop && pass_time >= clip->get_duration())
+			is_finished = true;
 	}
 
-	// レンダリング関数、現在のフレームを画面の指定位置にレンダリング、回転角度をサポート
-	void on_render(SDL_Renderer *renderer, const SDL_Point &pos_dst, double angle = 0) const
+	// レンダリング関数、現在のフレームを画面の指定位置に描画するようスプライトバッチに追加、回転角度をサポート
+	void on_render(const SDL_Point &pos_dst, double angle = 0) const
 	{
-		static SDL_Rect rect_dst;
+		if (!clip || clip->rect_src_list.empty())
+			return;
+
+		SpriteBatchManager *sprite_batch = SpriteBatchManager::instance();
+		static thread_local SDL_Rect rect_dst;
 		rect_dst.x = pos_dst.x, rect_dst.y = pos_dst.y;
-		rect_dst.w = width_frame, rect_dst.h = height_frame;
+		rect_dst.w = clip->width_frame, rect_dst.h = clip->height_frame;
 
-		// 現在のフレームのテクスチャを目標矩形位置にレンダリング
-		SDL_RenderCopyEx(renderer, texture, &rect_src_list[idx_frame], &rect_dst, angle, nullptr, SDL_RendererFlip::SDL_FLIP_NONE);
-		// rect_src_list: クリッピング矩形
-		// rect_dst: 目標矩形
-		// SDL_RendererFlip: 画像を水平または垂直方向に反転するかどうか
+		// 現在のフレームのソース矩形（クリッピング矩形）を目標矩形位置に描画
+		sprite_batch->draw(clip->texture, &clip->rect_src_list[clip->get_idx_frame(pass_time)], rect_dst, angle);
 	}
 
 private:
-	Timer timer;
-	bool is_loop = true;
-	size_t idx_frame = 0;
-	PlayCallback on_finished;
-
-	SDL_Texture *texture = nullptr;
-	std::vector<SDL_Rect> rect_src_list; // 各フレームのソース矩形リストを格納
-
-	int width_frame = 0, height_frame = 0; // 各フレームの幅と高さ
+	const AnimationClip *clip = nullptr; // 再生中のクリップ
+	double pass_time = 0;				 // 再生開始からの経過時間（秒）
+	bool is_finished = false;			 // ループしないクリップの再生が終了したかどうか
 };
 
 #endif // !_ANIMATION_H_
@@ -7,13 +7,30 @@
 class ArcherTower : public Tower
 {
 public:
-	ArcherTower()
+	// アニメーションクリップは TowerManager が create_clip_set() で作成し、すべての弓兵で共有する
+	ArcherTower(const ClipSet *clip_set)
 	{
-		// 防御塔のテクスチャを取得
-		static SDL_Texture *tex_archer = ResourcesManager::instance()
-											 ->get_texture_pool()
-											 .find(ResID::Tex_Archer)
-											 ->second;
+		set_clip_set(clip_set);
+
+		// タワーのサイズを設定
+		size.x = 48, size.y = 48;
+
+		// タワーの種類を設定
+		tower_type = TowerType::Archer;
+
+		// 発射スピードを設定
+		fire_speed = 6;
+
+		// 弾の種類を設定
+		bullet_type = BulletType::Arrow;
+	};
+	~ArcherTower() = default;
+
+	// アニメーションクリップを作成（ゲームワールドごとに一度だけ TowerManager が呼び出す）
+	static ClipSet create_clip_set()
+	{
+		// 防御塔のテクスチャ（アトラス上の矩形）を取得
+		const TextureRegion region_archer = ResourcesManager::instance()->find_region(ResID::Tex_Archer);
 
 		// アニメーションフレームインデックスを設定
 		// アイドルアニメーション
@@ -28,32 +45,20 @@ public:
 		static const std::vector<int> idx_list_fire_left = {18, 19, 20};
 		static const std::vector<int> idx_list_fire_right = {21, 22, 23};
 
-		// アニメーションを設定
+		ClipSet clip_set;
 		// アイドルアニメーション
-		anim_idle_up.set_frame_data(tex_archer, 3, 8, idx_list_idle_up);
-		anim_idle_down.set_frame_data(tex_archer, 3, 8, idx_list_idle_down);
-		anim_idle_left.set_frame_data(tex_archer, 3, 8, idx_list_idle_left);
-		anim_idle_right.set_frame_data(tex_archer, 3, 8, idx_list_idle_right);
+		clip_set.idle_up.set_frame_data(region_archer, 3, 8, idx_list_idle_up);
+		clip_set.idle_down.set_frame_data(region_archer, 3, 8, idx_list_idle_down);
+		clip_set.idle_left.set_frame_data(region_archer, 3, 8, idx_list_idle_left);
+		clip_set.idle_right.set_frame_data(region_archer, 3, 8, idx_list_idle_right);
 
 		// 発射アニメーション
-		anim_fire_up.set_frame_data(tex_archer, 3, 8, idx_list_fire_up);
-		anim_fire_down.set_frame_data(tex_archer, 3, 8, idx_list_fire_down);
-		anim_fire_left.set_frame_data(tex_archer, 3, 8, idx_list_fire_left);
-		anim_fire_right.set_frame_data(tex_archer, 3, 8, idx_list_fire_right);
-
-		// タワーのサイズを設定
-		size.x = 48, size.y = 48;
-
-		// タワーの種類を設定
-		tower_type = TowerType::Archer;
-
-		// 発射スピードを設定
-		fire_speed = 6;
-
-		// 弾の種類を設定
-		bullet_type = BulletType::Arrow;
-	};
-	~ArcherTower() = default;
+		clip_set.fire_up.set_frame_data(region_archer, 3, 8, idx_list_fire_up);
+		clip_set.fire_down.set_frame_data(region_archer, 3, 8, idx_list_fire_down);
+		clip_set.fire_left.set_frame_data(region_archer, 3, 8, idx_list_fire_left);
+		clip_set.fire_right.set_frame_data(region_archer, 3, 8, idx_list_fire_right);
+		return clip_set;
+	}
 };
 
 #endif // !_ARCHER_TOWER_H_
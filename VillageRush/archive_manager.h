@@ -0,0 +1,441 @@
+#ifndef _ARCHIVE_MANAGER_H_
+#define _ARCHIVE_MANAGER_H_
+
+/**
+ * @brief アセットアーカイブ管理クラス
+ *
+ * このクラスは、ゲームが読み込むファイル（テクスチャ、効果音、音楽、フォント、マップ、設定ファイル）を1つにまとめた
+ * アーカイブファイルをメモリマップし、各ファイルをコピーせずにメモリ上のデータとして提供するシングルトンクラスです。
+ * 起動時のファイルのオープンとシークが、ファイルの数に関係なく1回で済むようになります。
+ *
+ * ファイル形式（リトルエンディアン）:
+ * - ヘッダー: "VRPK"(4) + バージョン(u16) + 予約(u16) + ファイル数(u32)
+ * - 索引: ファイルごとに パスの長さ(u16) + パス + オフセット(u64) + サイズ(u64) + チェックサム(u32, FNV-1a)
+ * - データ: 各ファイルの内容（先頭を16バイト境界に揃える）
+ *
+ * 主な機能:
+ * - open() でアーカイブをメモリマップして索引を読み込む
+ * - open_rw() でファイルの SDL_RWops を作成（アーカイブにある場合は SDL_RWFromConstMem、ない場合は通常のファイル）
+ * - pack() でファイルのリストからアーカイブを作成（アーカイブ作成ツールで使用）
+ *
+ * 使用方法:
+ * - ファイルはゲームで使用する相対パス（"resources/player.png"、"config.json" など）で検索する
+ * - テキストファイルは AssetStream で std::ifstream と同じように読み込む
+ *
+ * 注意事項:
+ * - アーカイブが存在しない場合や、アーカイブに含まれないファイルは、従来どおり個別のファイルから読み込みます
+ * - 各ファイルのチェックサムは最初に参照したときに検証し、一致しない（アーカイブが破損している）ファイルは
+ *   アーカイブに含まれないものとして扱います（個別のファイルから読み込む）
+ * - open_rw() が返す SDL_RWops はアーカイブを閉じるまで有効なメモリを参照するため、音楽やフォントのように
+ *   読み込み後もデータを参照するリソースより先にアーカイブを閉じないこと
+ * - 索引は読み込み後に変更されないため、ワーカースレッドからも（このスレッドのインスタンスのポインタを渡して）参照できます
+ */
+
+#include "manager.h"
+
+#include <SDL.h>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <streambuf>
+#include <istream>
+#include <memory>
+#include <atomic>
+#include <unordered_map>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+class ArchiveManager : public Manager<ArchiveManager>
+{
+	friend class Manager<ArchiveManager>;
+
+public:
+	// アーカイブに含まれるファイル（data はメモリマップされた領域を指す）
+	struct Entry
+	{
+		const uint8_t *data = nullptr;
+		size_t size = 0;
+		uint32_t checksum = 0;
+		size_t idx = 0; // 索引上の番号（検証状態の参照に使用）
+	};
+
+public:
+	// アーカイブをメモリマップして索引を読み込む（存在しない・形式が正しくない場合はfalse、アーカイブを使用しない）
+	bool open(const std::string &path)
+	{
+		close();
+
+		if (!map_file(path))
+			return false;
+
+		if (!read_index())
+		{
+			close();
+			return false;
+		}
+
+		return true;
+	}
+
+	void close()
+	{
+		entry_pool.clear();
+		verify_state_list.reset();
+		unmap_file();
+	}
+
+	bool check_open() const
+	{
+		return data_archive != nullptr;
+	}
+
+	// パスを指定してファイルを取得（アーカイブに含まれない場合、チェックサムが一致しない場合はnullptr）
+	const Entry *find_entry(const std::string &path) const
+	{
+		const auto &itor = entry_pool.find(path);
+		if (itor == entry_pool.end())
+			return nullptr;
+
+		return verify_entry(itor->second) ? &itor->second : nullptr;
+	}
+
+	// ファイルの SDL_RWops を作成（アーカイブにある場合はコピーせずにメモリから、ない場合はファイルから読み込む）
+	SDL_RWops *open_rw(const std::string &path) const
+	{
+		const Entry *entry = find_entry(path);
+		if (entry)
+			return SDL_RWFromConstMem(entry->data, (int)entry->size);
+
+		return SDL_RWFromFile(path.c_str(), "rb");
+	}
+
+	// ファイルの内容を取得（アーカイブにある場合はコピーせずにメモリを参照し、ない場合は buffer にファイルを読み込む）
+	bool load_data(const std::string &path, std::string &buffer, const uint8_t *&data, size_t &size) const
+	{
+		const Entry *entry = find_entry(path);
+		if (entry)
+		{
+			data = entry->data, size = entry->size;
+			return true;
+		}
+
+		std::ifstream file(path, std::ios::binary);
+		if (!file.good())
+			return false;
+		buffer.assign((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+		data = (const uint8_t *)buffer.data(), size = buffer.size();
+		return true;
+	}
+
+	// ファイルのリストからアーカイブを作成（パスはそのまま索引のキーになる）
+	static bool pack(const std::string &path_out, const std::vector<std::string> &path_list)
+	{
+		// すべてのファイルを読み込み、索引のサイズからデータの配置を決定
+		std::vector<std::string> content_list;
+		size_t size_header = sizeof(magic) + sizeof(uint16_t) * 2 + sizeof(uint32_t);
+		for (const std::string &path : path_list)
+		{
+			std::ifstream file(path, std::ios::binary);
+			if (!file.good() || path.size() > UINT16_MAX)
+				return false;
+
+			content_list.emplace_back((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+			size_header += sizeof(uint16_t) + path.size() + sizeof(uint64_t) * 2 + sizeof(uint32_t);
+		}
+
+		std::vector<uint64_t> offset_list;
+		uint64_t offset = align_offset(size_header);
+		for (const std::string &content : content_list)
+		{
+			offset_list.push_back(offset);
+			offset = align_offset(offset + content.size());
+		}
+
+		std::ofstream file(path_out, std::ios::binary | std::ios::trunc);
+		if (!file.good())
+			return false;
+
+		file.write(magic, sizeof(magic));
+		write_value<uint16_t>(file, version);
+		write_value<uint16_t>(file, 0);
+		write_value<uint32_t>(file, (uint32_t)path_list.size());
+		for (size_t i = 0; i < path_list.size(); i++)
+		{
+			write_value<uint16_t>(file, (uint16_t)path_list[i].size());
+			file.write(path_list[i].data(), path_list[i].size());
+			write_value<uint64_t>(file, offset_list[i]);
+			write_value<uint64_t>(file, content_list[i].size());
+			write_value<uint32_t>(file, compute_checksum((const uint8_t *)content_list[i].data(), content_list[i].size()));
+		}
+
+		for (size_t i = 0; i < content_list.size(); i++)
+		{
+			// 前のデータの終わりから16バイト境界までを0で埋める
+			const std::streamoff size_padding = (std::streamoff)offset_list[i] - (std::streamoff)file.tellp();
+			for (std::streamoff j = 0; j < size_padding; j++)
+				file.put('\0');
+			file.write(content_list[i].data(), content_list[i].size());
+		}
+
+		return file.good();
+	}
+
+	// FNV-1a（32ビット）
+	static uint32_t compute_checksum(const uint8_t *data, size_t size)
+	{
+		uint32_t hash = 2166136261u;
+		for (size_t i = 0; i < size; i++)
+		{
+			hash ^= data[i];
+			hash *= 16777619u;
+		}
+		return hash;
+	}
+
+protected:
+	ArchiveManager() = default;
+	~ArchiveManager()
+	{
+		close();
+	}
+
+private:
+	static constexpr char magic[4] = {'V', 'R', 'P', 'K'};
+	static constexpr uint16_t version = 1;
+	static constexpr uint64_t alignment = 16; // 各ファイルのデータの先頭の境界
+
+private:
+	std::unordered_map<std::string, Entry> entry_pool; // パスとファイルの対応
+
+	// ファイルごとのチェックサムの検証状態（VerifyState）
+	// ワーカースレッドからも参照されるためアトミックにする（同時に検証した場合も結果は同じ）
+	mutable std::unique_ptr<std::atomic<uint8_t>[]> verify_state_list;
+
+	const uint8_t *data_archive = nullptr; // メモリマップされたアーカイブ全体
+	size_t size_archive = 0;
+#ifdef _WIN32
+	HANDLE handle_file = INVALID_HANDLE_VALUE;
+	HANDLE handle_mapping = nullptr;
+#endif
+
+private:
+	enum VerifyState : uint8_t
+	{
+		Unverified = 0,
+		Valid,
+		Invalid
+	};
+
+	// 最初の参照時のみチェックサムを計算し、結果を保持する
+	bool verify_entry(const Entry &entry) const
+	{
+		std::atomic<uint8_t> &state = verify_state_list[entry.idx];
+		uint8_t val_state = state.load(std::memory_order_acquire);
+		if (val_state == Unverified)
+		{
+			val_state = compute_checksum(entry.data, entry.size) == entry.checksum ? Valid : Invalid;
+			state.store(val_state, std::memory_order_release);
+		}
+		return val_state == Valid;
+	}
+
+	static uint64_t align_offset(uint64_t offset)
+	{
+		return (offset + alignment - 1) / alignment * alignment;
+	}
+
+	template <typename T>
+	static void write_value(std::ofstream &file, T val)
+	{
+		file.write(reinterpret_cast<const char *>(&val), sizeof(T));
+	}
+
+	// メモリ上の位置から値を読み込み、位置を進める（範囲外の場合はfalse）
+	template <typename T>
+	bool read_value(size_t &pos, T &val) const
+	{
+		if (pos + sizeof(T) > size_archive)
+			return false;
+
+		std::memcpy(&val, data_archive + pos, sizeof(T));
+		pos += sizeof(T);
+		return true;
+	}
+
+	bool read_index()
+	{
+		size_t pos = 0;
+		char magic_file[4] = {0};
+		uint16_t version_file = 0, reserved = 0;
+		uint32_t num_entry = 0;
+		if (!read_value(pos, magic_file) || std::memcmp(magic_file, magic, sizeof(magic)) != 0)
+			return false;
+		if (!read_value(pos, version_file) || !read_value(pos, reserved) || !read_value(pos, num_entry) || version_file != version)
+			return false;
+
+		// 索引のサイズの分だけ検証状態を確保（値初期化により Unverified になる）
+		if ((uint64_t)num_entry * (sizeof(uint16_t) + sizeof(uint64_t) * 2 + sizeof(uint32_t)) > size_archive - pos)
+			return false;
+		verify_state_list.reset(new std::atomic<uint8_t>[num_entry]());
+
+		for (uint32_t i = 0; i < num_entry; i++)
+		{
+			uint16_t length_path = 0;
+			uint64_t offset = 0, size = 0;
+			Entry entry;
+			if (!read_value(pos, length_path) || pos + length_path > size_archive)
+				return false;
+			const std::string path((const char *)data_archive + pos, length_path);
+			pos += length_path;
+
+			if (!read_value(pos, offset) || !read_value(pos, size) || !read_value(pos, entry.checksum))
+				return false;
+			if (offset > size_archive || size > size_archive - offset)
+				return false;
+
+			entry.data = data_archive + offset;
+			entry.size = (size_t)size;
+			entry.idx = i;
+			entry_pool[path] = entry;
+		}
+
+		return true;
+	}
+
+#ifdef _WIN32
+	bool map_file(const std::string &path)
+	{
+		handle_file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (handle_file == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER size_file;
+		if (!GetFileSizeEx(handle_file, &size_file) || size_file.QuadPart == 0)
+		{
+			unmap_file();
+			return false;
+		}
+
+		handle_mapping = CreateFileMappingA(handle_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!handle_mapping)
+		{
+			unmap_file();
+			return false;
+		}
+
+		data_archive = (const uint8_t *)MapViewOfFile(handle_mapping, FILE_MAP_READ, 0, 0, 0);
+		if (!data_archive)
+		{
+			unmap_file();
+			return false;
+		}
+
+		size_archive = (size_t)size_file.QuadPart;
+		return true;
+	}
+
+	void unmap_file()
+	{
+		if (data_archive)
+			UnmapViewOfFile(data_archive);
+		if (handle_mapping)
+			CloseHandle(handle_mapping);
+		if (handle_file != INVALID_HANDLE_VALUE)
+			CloseHandle(handle_file);
+
+		data_archive = nullptr, size_archive = 0;
+		handle_mapping = nullptr, handle_file = INVALID_HANDLE_VALUE;
+	}
+#else
+	bool map_file(const std::string &path)
+	{
+		const int fd = ::open(path.c_str(), O_RDONLY);
+		if (fd < 0)
+			return false;
+
+		struct stat stat_file;
+		if (fstat(fd, &stat_file) != 0 || stat_file.st_size == 0)
+		{
+			::close(fd);
+			return false;
+		}
+
+		// マッピングはファイルを閉じても有効
+		void *data = mmap(nullptr, (size_t)stat_file.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		::close(fd);
+		if (data == MAP_FAILED)
+			return false;
+
+		data_archive = (const uint8_t *)data;
+		size_archive = (size_t)stat_file.st_size;
+		return true;
+	}
+
+	void unmap_file()
+	{
+		if (data_archive)
+			munmap((void *)data_archive, size_archive);
+
+		data_archive = nullptr, size_archive = 0;
+	}
+#endif
+};
+
+/*アーカイブのファイル（なければ通常のファイル）を読み込む入力ストリーム、std::ifstream と同じように使用する*/
+class AssetStream : public std::istream
+{
+public:
+	explicit AssetStream(const std::string &path) : std::istream(nullptr)
+	{
+		const ArchiveManager::Entry *entry = ArchiveManager::instance()->find_entry(path);
+		if (entry)
+		{
+			buf_memory.set_data((const char *)entry->data, entry->size);
+			rdbuf(&buf_memory);
+		}
+		else if (buf_file.open(path, std::ios::in))
+			rdbuf(&buf_file);
+		else
+			setstate(std::ios::failbit);
+	}
+	~AssetStream() = default;
+
+	void close()
+	{
+		if (buf_file.is_open())
+			buf_file.close();
+	}
+
+private:
+	// メモリ上のデータをコピーせずに読み込むストリームバッファ
+	class MemoryBuf : public std::streambuf
+	{
+	public:
+		void set_data(const char *data, size_t size)
+		{
+			char *begin = const_cast<char *>(data); // 読み込み専用（書き込み用の領域は設定しない）
+			setg(begin, begin, begin + size);
+		}
+	};
+
+private:
+	MemoryBuf buf_memory;
+	std::filebuf buf_file;
+};
+
+#endif // !_ARCHIVE_MANAGER_H_
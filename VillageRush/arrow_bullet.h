@@ -3,49 +3,57 @@
 
 #include "bullet.h"
 #include "resources_manager.h"
+#include "random_manager.h"
 
 class ArrowBullet : public Bullet
 {
 public:
+	// アニメーションクリップは BulletManager が create_clip() で作成し、オブジェクトプールから取り出すたびに設定する
 	ArrowBullet()
 	{
-		// 弾のテクスチャを取得
-		static SDL_Texture *tex_arrow = ResourcesManager::instance()
-											->get_texture_pool()
-											.find(ResID::Tex_BulletArrow)
-											->second;
-
-		// アニメーションインデックスを設定（2フレーム）
-		static const std::vector<int> idx_list = {0, 1};
-
-		// アニメーションのループ、間隔、フレームを設定
-		animation.set_loop(true);
-		animation.set_interval(0.1);
-		animation.set_frame_data(tex_arrow, 2, 1, idx_list);
-
 		// 回転可能に設定
 		can_rotate = true;
+		// 種類を設定
+		type = BulletType::Arrow;
 		// サイズを設定
 		size.x = 48, size.y = 48;
 	}
 	~ArrowBullet() = default;
 
+	// アニメーションクリップを作成（ゲームワールドごとに一度だけ BulletManager が呼び出し、すべての矢で共有）
+	static AnimationClip create_clip()
+	{
+		// 弾のテクスチャ（アトラス上の矩形）を取得
+		const TextureRegion region_arrow = ResourcesManager::instance()->find_region(ResID::Tex_BulletArrow);
+
+		// アニメーションインデックスを設定（2フレーム）
+		static const std::vector<int> idx_list = {0, 1};
+
+		// アニメーションのループ、間隔、フレームを設定
+		AnimationClip clip;
+		clip.set_loop(true);
+		clip.set_interval(0.1);
+		clip.set_frame_data(region_arrow, 2, 1, idx_list);
+		return clip;
+	}
+
 	void on_collide(Enemy *enemy) override
 	{
 		// サウンドエフェクトを取得
-		static const ResourcesManager::SoundPool &sound_pool = ResourcesManager::instance()->get_sound_pool();
+		const ResourcesManager *resources_manager = ResourcesManager::instance();
+		RandomManager *random_manager = RandomManager::instance();
 
-		// 3種類のランダムサウンドエフェクトを設定
-		switch (rand() % 3)
+		// 3種類のランダムサウンドエフェクトを設定（演出用の乱数列を使用）
+		switch (random_manager->cosmetic_int(3))
 		{
 		case 0:
-			Mix_PlayChannel(-1, sound_pool.find(ResID::Sound_ArrowHit_1)->second, 0);
+			resources_manager->play_sound(ResID::Sound_ArrowHit_1);
 			break;
 		case 1:
-			Mix_PlayChannel(-1, sound_pool.find(ResID::Sound_ArrowHit_2)->second, 0);
+			resources_manager->play_sound(ResID::Sound_ArrowHit_2);
 			break;
 		case 2:
-			Mix_PlayChannel(-1, sound_pool.find(ResID::Sound_ArrowHit_3)->second, 0);
+			resources_manager->play_sound(ResID::Sound_ArrowHit_3);
 			break;
 		}
 
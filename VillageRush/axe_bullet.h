@@ -3,50 +3,58 @@
 
 #include "bullet.h"
 #include "resources_manager.h"
+#include "random_manager.h"
 
 class AxeBullet : public Bullet
 {
 public:
+	// アニメーションクリップは BulletManager が create_clip() で作成し、オブジェクトプールから取り出すたびに設定する
 	AxeBullet()
 	{
-		// 弾のテクスチャを取得
-		static SDL_Texture *tex_axe = ResourcesManager::instance()
-										  ->get_texture_pool()
-										  .find(ResID::Tex_BulletAxe)
-										  ->second;
-
-		// アニメーションインデックスを設定（八フレーム）
-		static const std::vector<int> idx_list = {0, 1, 2, 3, 4, 5, 6, 7};
-
-		// アニメーションのループ、間隔、フレームを設定
-		animation.set_loop(true);
-		animation.set_interval(0.1);
-		animation.set_frame_data(tex_axe, 4, 2, idx_list);
-
 		// 回転不可能に設定
 		can_rotate = false;
+		// 種類を設定
+		type = BulletType::Axe;
 		// サイズを設定
 		size.x = 48, size.y = 48;
 	};
 
 	~AxeBullet() = default;
 
+	// アニメーションクリップを作成（ゲームワールドごとに一度だけ BulletManager が呼び出し、すべての斧で共有）
+	static AnimationClip create_clip()
+	{
+		// 弾のテクスチャ（アトラス上の矩形）を取得
+		const TextureRegion region_axe = ResourcesManager::instance()->find_region(ResID::Tex_BulletAxe);
+
+		// アニメーションインデックスを設定（八フレーム）
+		static const std::vector<int> idx_list = {0, 1, 2, 3, 4, 5, 6, 7};
+
+		// アニメーションのループ、間隔、フレームを設定
+		AnimationClip clip;
+		clip.set_loop(true);
+		clip.set_interval(0.1);
+		clip.set_frame_data(region_axe, 4, 2, idx_list);
+		return clip;
+	}
+
 	void on_collide(Enemy *enemy) override
 	{
 		// サウンドエフェクトを取得
-		static const ResourcesManager::SoundPool &sound_pool = ResourcesManager::instance()->get_sound_pool();
+		const ResourcesManager *resources_manager = ResourcesManager::instance();
+		RandomManager *random_manager = RandomManager::instance();
 
-		// 3種類のランダムサウンドエフェクトを設定
-		switch (rand() % 3)
+		// 3種類のランダムサウンドエフェクトを設定（演出用の乱数列を使用）
+		switch (random_manager->cosmetic_int(3))
 		{
 		case 0:
-			Mix_PlayChannel(-1, sound_pool.find(ResID::Sound_AxeHit_1)->second, 0);
+			resources_manager->play_sound(ResID::Sound_AxeHit_1);
 			break;
 		case 1:
-			Mix_PlayChannel(-1, sound_pool.find(ResID::Sound_AxeHit_2)->second, 0);
+			resources_manager->play_sound(ResID::Sound_AxeHit_2);
 			break;
 		case 2:
-			Mix_PlayChannel(-1, sound_pool.find(ResID::Sound_AxeHit_3)->second, 0);
+			resources_manager->play_sound(ResID::Sound_AxeHit_3);
 			break;
 		}
 
@@ -55,7 +55,7 @@ public:
 	void on_render(SDL_Renderer *renderer)
 	{
 		// 描画用の矩形を静的変数として定義
-		static SDL_Rect rect_dst;
+		static thread_local SDL_Rect rect_dst;
 
 		// バックグラウンドの描画位置とサイズを設定（中心位置からの相対位置）
 		rect_dst.x = (int)(pos_center.x - size_background.x / 2);
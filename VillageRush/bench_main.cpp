@@ -0,0 +1,78 @@
+#define SDL_MAIN_HANDLED
+#define ALLOC_COUNTER_IMPLEMENTATION // このファイルで operator new を置き換え、ヒープ確保回数を数える（デバッグビルドのみ）
+
+#include "benchmark_runner.h"
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include <fstream>
+
+// 負荷ベンチマークのエントリーポイント
+// 大量の敵・防御塔・弾を配置したシナリオで各マネージャーの更新時間を計測し、結果をJSON形式で出力する
+// 使用例: village_rush_bench --ticks 300 --counts 1000,10000,100000 --scenario tower_field --out bench.json
+// ビルド例（Linux）:
+//   g++ -std=c++17 -O2 -pthread bench_main.cpp -o village_rush_bench $(sdl2-config --cflags --libs) -lSDL2_image -lSDL2_mixer -lSDL2_ttf -lSDL2_gfx -lcjson
+int main(int argc, char** argv)
+{
+	BenchmarkRunner benchmark_runner;
+	std::string path_out;
+	bool is_valid_args = true;
+
+	// コマンドライン引数の解析
+	for (int i = 1; i < argc; i++)
+	{
+		const std::string arg = argv[i];
+		if (arg == "--ticks" && i + 1 < argc)
+		{
+			int num_tick = std::atoi(argv[++i]);
+			is_valid_args = is_valid_args && num_tick > 0;
+			benchmark_runner.set_num_tick(num_tick);
+		}
+		else if (arg == "--counts" && i + 1 < argc)
+		{
+			// カンマ区切りのエンティティ数リスト
+			std::vector<int> count_list;
+			std::string str_count;
+			std::stringstream str_stream(argv[++i]);
+			while (std::getline(str_stream, str_count, ','))
+			{
+				int count = std::atoi(str_count.c_str());
+				is_valid_args = is_valid_args && count > 0;
+				count_list.push_back(count);
+			}
+			is_valid_args = is_valid_args && !count_list.empty();
+			benchmark_runner.set_count_list(count_list);
+		}
+		else if (arg == "--scenario" && i + 1 < argc)
+		{
+			is_valid_args = is_valid_args && benchmark_runner.check_scenario(argv[++i]);
+			benchmark_runner.set_scenario_filter(argv[i]);
+		}
+		else if (arg == "--out" && i + 1 < argc)
+			path_out = argv[++i];
+		else
+			is_valid_args = false;
+	}
+	if (!is_valid_args)
+	{
+		std::cerr << "usage: " << argv[0] << " [--ticks N] [--counts N,N,...] [--scenario enemy_swarm|tower_field|bullet_storm] [--out FILE]" << std::endl;
+		return -1;
+	}
+
+	// 結果の出力先（指定がない場合は標準出力）
+	if (path_out.empty())
+	{
+		benchmark_runner.run(std::cout);
+		return 0;
+	}
+
+	std::ofstream file(path_out);
+	if (!file.good())
+	{
+		std::cerr << u8"出力ファイルを開けません: " << path_out << std::endl;
+		return -1;
+	}
+	benchmark_runner.run(file);
+	return 0;
+};
@@ -0,0 +1,307 @@
+#ifndef _BENCHMARK_RUNNER_H_
+#define _BENCHMARK_RUNNER_H_
+
+/**
+ * @brief 負荷ベンチマーク実行クラス
+ *
+ * このクラスは、既存のマップ上に大量のエンティティを配置した負荷シナリオを生成し、
+ * 各マネージャーの更新時間を計測してJSON形式で出力します。
+ *
+ * シナリオ:
+ * - enemy_swarm: 敵をN体生成（EnemyManager::spawn_enemy）
+ * - tower_field: 設置可能なすべてのタイルに防御塔を配置し（TowerManager::place_tower）、敵をN体生成
+ * - bullet_storm: 弾をN発生成し（BulletManager::spawn_bullet）、敵を一定数生成
+ *
+ * 計測中は毎刻み、計測対象外の時間で敵と弾を指定数まで補充し、負荷を一定に保ちます。
+ * 計測結果は刻みごとの更新時間の平均・中央値（p50）・99パーセンタイル（p99）で、単位はマイクロ秒です。
+ * あわせて、更新中のヒープ確保回数（AllocCounter、デバッグビルドのみ）の合計と、後半の刻み（定常状態）での1刻みあたりの最大値を出力します。
+ */
+
+#include "game_manager.h"
+#include "random_manager.h"
+#include "alloc_counter.h"
+
+#include <SDL.h>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <iostream>
+
+class BenchmarkRunner
+{
+public:
+	BenchmarkRunner() = default;
+	~BenchmarkRunner() = default;
+
+	// 計測する刻み数
+	void set_num_tick(int val)
+	{
+		num_tick = val;
+	}
+
+	// シナリオごとのエンティティ数のリスト
+	void set_count_list(const std::vector<int> &val)
+	{
+		count_list = val;
+	}
+
+	// 実行するシナリオ（空の場合はすべて）
+	void set_scenario_filter(const std::string &val)
+	{
+		scenario_filter = val;
+	}
+
+	// シナリオ名が有効かどうかをチェック
+	bool check_scenario(const std::string &name) const
+	{
+		return std::find(scenario_list.begin(), scenario_list.end(), name) != scenario_list.end();
+	}
+
+	// すべてのシナリオを実行し、結果をJSON形式で出力
+	void run(std::ostream &os)
+	{
+		os << "{\n";
+		os << "  \"ticks\": " << num_tick << ",\n";
+		os << "  \"scenarios\": [";
+
+		bool is_first = true;
+		for (const std::string &name : scenario_list)
+		{
+			if (!scenario_filter.empty() && name != scenario_filter)
+				continue;
+
+			for (int count : count_list)
+			{
+				std::cerr << name << " x " << count << std::endl;
+
+				// シナリオごとに独立したゲームワールドを作成して実行
+				ScenarioResult result;
+				run_scenario(name, count, result);
+
+				os << (is_first ? "\n" : ",\n");
+				write_result(os, name, count, result);
+				is_first = false;
+			}
+		}
+
+		os << "\n  ]\n";
+		os << "}" << std::endl;
+	}
+
+private:
+	// 計測対象（ゲームワールドの更新順と同じ）
+	enum class Target
+	{
+		Timer,
+		Wave,
+		Enemy,
+		Bullet,
+		Tower,
+		Coin,
+		Player,
+		Total
+	};
+
+	// シナリオの計測結果
+	struct ScenarioResult
+	{
+		std::vector<double> time_list[(int)Target::Total + 1]; // 刻みごとの更新時間（マイクロ秒）
+		std::vector<size_t> num_alloc_list;					   // 刻みごとの更新中のヒープ確保回数
+
+		// 計測終了時のエンティティ数
+		size_t num_enemy = 0;
+		size_t num_bullet = 0;
+		size_t num_tower = 0;
+		size_t num_coin_prop = 0;
+	};
+
+private:
+	const std::vector<std::string> scenario_list = {"enemy_swarm", "tower_field", "bullet_storm"};
+
+	int num_tick = 300;
+	std::vector<int> count_list = {1000, 10000, 100000};
+	std::string scenario_filter;
+
+	const int num_enemy_bullet_storm = 100; // bullet_stormシナリオの敵の数
+
+private:
+	// シナリオを実行（ワールドを作成し、終了時に破棄）
+	void run_scenario(const std::string &name, int count, ScenarioResult &result)
+	{
+		GameManager::create_headless_world();
+		RandomManager::instance()->set_seed(0);
+
+		// シナリオ生成用の乱数（計測ごとに同じ配置を再現するため固定シード）
+		std::mt19937 random_engine(0);
+
+		if (name == "tower_field")
+			place_all_tower();
+
+		const size_t num_enemy = name == "bullet_storm" ? num_enemy_bullet_storm : count;
+		const size_t num_bullet = name == "bullet_storm" ? count : 0;
+
+		// 計測結果の記録自体がヒープ確保にならないよう、先に容量を確保
+		for (std::vector<double> &time_list : result.time_list)
+			time_list.reserve(num_tick);
+		result.num_alloc_list.reserve(num_tick);
+
+		const double delta = 1.0 / ConfigManager::instance()->basic_template.tick_rate;
+		for (int i = 0; i < num_tick; i++)
+		{
+			// 計測対象外：エンティティ数を補充
+			fill_enemy(num_enemy, random_engine);
+			fill_bullet(num_bullet, random_engine);
+
+			// 各マネージャーの更新時間とヒープ確保回数を計測
+			const size_t num_alloc_begin = AllocCounter::get_num_alloc();
+			const auto time_begin = std::chrono::steady_clock::now();
+			auto time_last = time_begin;
+			auto record_time = [&](Target target)
+			{
+				const auto time_now = std::chrono::steady_clock::now();
+				result.time_list[(int)target].push_back(std::chrono::duration<double, std::micro>(time_now - time_last).count());
+				time_last = time_now;
+			};
+
+			TimerManager::instance()->on_update(delta);
+			record_time(Target::Timer);
+			WaveManager::instance()->on_update(delta);
+			record_time(Target::Wave);
+			EnemyManager::instance()->on_update(delta);
+			record_time(Target::Enemy);
+			BulletManager::instance()->on_update(delta);
+			record_time(Target::Bullet);
+			TowerManager::instance()->on_update(delta);
+			record_time(Target::Tower);
+			CoinManager::instance()->on_update(delta);
+			record_time(Target::Coin);
+			PlayerManager::instance()->on_update(delta);
+			record_time(Target::Player);
+
+			result.time_list[(int)Target::Total].push_back(std::chrono::duration<double, std::micro>(time_last - time_begin).count());
+			result.num_alloc_list.push_back(AllocCounter::get_num_alloc() - num_alloc_begin);
+		}
+
+		result.num_enemy = EnemyManager::instance()->get_enemy_list().size();
+		result.num_bullet = BulletManager::instance()->get_bullet_list().size();
+		result.num_tower = TowerManager::instance()->get_tower_list().size();
+		result.num_coin_prop = CoinManager::instance()->get_coin_prop_list().size();
+
+		GameManager::destroy_world();
+	}
+
+	// 設置可能なすべてのタイルに防御塔を配置（タイプは順番に切り替える）
+	void place_all_tower()
+	{
+		const Map &map = ConfigManager::instance()->map;
+		const SDL_Point &idx_home = map.get_idx_home();
+
+		int idx_type = 0;
+		for (int y = 0; y < (int)map.get_height(); y++)
+		{
+			for (int x = 0; x < (int)map.get_width(); x++)
+			{
+				const Tile &tile = map.get_tile_map().get_tile(x, y);
+				if (tile.decoration >= 0 || tile.direction != Tile::Direction::None || map.check_tower({x, y}) || (x == idx_home.x && y == idx_home.y))
+					continue;
+
+				TowerManager::instance()->place_tower((TowerType)(idx_type++ % 3), {x, y});
+			}
+		}
+	}
+
+	// 敵の数がnum_enemyになるまで、ランダムなタイプとスポーンポイントで生成
+	void fill_enemy(size_t num_enemy, std::mt19937 &random_engine)
+	{
+		EnemyManager *enemy_manager = EnemyManager::instance();
+		const Map::SpawnerRoutePool &spawner_route_pool = ConfigManager::instance()->map.get_spawner_route_pool();
+		if (spawner_route_pool.empty())
+			return;
+
+		std::vector<int> idx_spawn_point_list;
+		for (const auto &pair : spawner_route_pool)
+			idx_spawn_point_list.push_back(pair.first);
+		std::sort(idx_spawn_point_list.begin(), idx_spawn_point_list.end());
+
+		const int num_enemy_type = (int)ConfigManager::instance()->enemy_template_list.size();
+		while (enemy_manager->get_enemy_list().size() < num_enemy)
+		{
+			// 標準ライブラリの実装によらず同じ配置になるよう、RandomManager と同じ変換を使用（引数の評価順にも依存しない）
+			const int enemy_type = RandomManager::generate_int(random_engine, num_enemy_type);
+			const int idx_spawn_point = idx_spawn_point_list[RandomManager::generate_int(random_engine, (int)idx_spawn_point_list.size())];
+			enemy_manager->spawn_enemy(enemy_type, idx_spawn_point);
+		}
+	}
+
+	// 弾の数がnum_bulletになるまで、マップ内のランダムな位置と方向で生成
+	void fill_bullet(size_t num_bullet, std::mt19937 &random_engine)
+	{
+		BulletManager *bullet_manager = BulletManager::instance();
+		const SDL_Rect &rect_tile_map = ConfigManager::instance()->rect_tile_map;
+
+		while (bullet_manager->get_bullet_list().size() < num_bullet)
+		{
+			// 防御塔の弾と同程度の速度（1秒あたり6タイル）、敵をすぐに倒さないよう小さなダメージ
+			const double angle = RandomManager::generate_real(random_engine) * 2 * 3.1415926535;
+			const Vector2 velocity = Vector2(std::cos(angle), std::sin(angle)) * 6 * SIZE_TILE;
+			const BulletType type = (BulletType)RandomManager::generate_int(random_engine, 3);
+			const double x = rect_tile_map.x + RandomManager::generate_real(random_engine) * rect_tile_map.w;
+			const double y = rect_tile_map.y + RandomManager::generate_real(random_engine) * rect_tile_map.h;
+			bullet_manager->spawn_bullet(type, {x, y}, velocity, 1);
+		}
+	}
+
+	// 計測時間リストから平均・p50・p99を出力
+	void write_stat(std::ostream &os, std::vector<double> time_list) const
+	{
+		if (time_list.empty())
+		{
+			os << "{\"mean_us\": 0, \"p50_us\": 0, \"p99_us\": 0}";
+			return;
+		}
+
+		double sum = 0;
+		for (double time : time_list)
+			sum += time;
+		std::sort(time_list.begin(), time_list.end());
+
+		const size_t num = time_list.size();
+		os << "{\"mean_us\": " << sum / num
+		   << ", \"p50_us\": " << time_list[num / 2]
+		   << ", \"p99_us\": " << time_list[std::min(num - 1, (size_t)(num * 0.99))] << "}";
+	}
+
+	void write_result(std::ostream &os, const std::string &name, int count, const ScenarioResult &result) const
+	{
+		static const char *str_target_list[] = {"timer", "wave", "enemy", "bullet", "tower", "coin", "player", "total"};
+
+		os << "    {\n";
+		os << "      \"name\": \"" << name << "\",\n";
+		os << "      \"count\": " << count << ",\n";
+		os << "      \"entities\": {\"enemies\": " << result.num_enemy << ", \"bullets\": " << result.num_bullet
+		   << ", \"towers\": " << result.num_tower << ", \"coin_props\": " << result.num_coin_prop << "},\n";
+
+		// ヒープ確保回数（前半はプールやリストの容量が増える期間のため、定常状態の値は後半の刻みから求める）
+		size_t num_alloc_total = 0, num_alloc_steady_max = 0;
+		for (size_t i = 0; i < result.num_alloc_list.size(); i++)
+		{
+			num_alloc_total += result.num_alloc_list[i];
+			if (i >= result.num_alloc_list.size() / 2)
+				num_alloc_steady_max = std::max(num_alloc_steady_max, result.num_alloc_list[i]);
+		}
+		os << "      \"heap_alloc\": {\"total\": " << num_alloc_total << ", \"steady_max_per_tick\": " << num_alloc_steady_max << "},\n";
+		os << "      \"update\": {\n";
+		for (int i = 0; i <= (int)Target::Total; i++)
+		{
+			os << "        \"" << str_target_list[i] << "\": ";
+			write_stat(os, result.time_list[i]);
+			os << (i < (int)Target::Total ? ",\n" : "\n");
+		}
+		os << "      }\n";
+		os << "    }";
+	}
+};
+
+#endif // !_BENCHMARK_RUNNER_H_
@@ -20,6 +20,7 @@
 
 #include "vector2.h"
 #include "enemy.h"
+#include "bullet_type.h"
 #include "animation.h"
 #include "config_manager.h"
 
@@ -28,7 +29,27 @@ class Bullet
 public:
 	Bullet() = default;
 
-	~Bullet() = default;
+	virtual ~Bullet() = default;
+
+	// 生成直後の状態に戻す（オブジェクトプールから再利用する場合に呼び出す）
+	virtual void reset()
+	{
+		is_valid = true;
+		is_collisionable = true;
+		animation.reset();
+	}
+
+	// 種類ごとのアニメーションクリップを設定（BulletManager がオブジェクトプールから取り出すたびに呼び出す）
+	void set_clip(const AnimationClip *clip)
+	{
+		animation.play(clip);
+	}
+
+	// 弾の種類を取得（返却先のオブジェクトプールの判別に使用）
+	BulletType get_type() const
+	{
+		return type;
+	}
 
 	// 弾のスピードと回転角度を設定
 	void set_velocity_and_rotation(const Vector2 &velocity)
@@ -111,7 +132,7 @@ public:
 		position += velocity * delta; // スピードに基づいて弾の位置を更新
 
 		// マップの境界矩形を取得（境界チェック用）
-		static const SDL_Rect &rect_map = ConfigManager::instance()->rect_tile_map;
+		const SDL_Rect &rect_map = ConfigManager::instance()->rect_tile_map;
 
 		// 弾がマップの境界を超えているかチェック、超えていれば無効とマーク
 		if (position.x - size.x / 2 <= rect_map.x || position.x + size.x / 2 >= rect_map.x + rect_map.w || position.y - size.y / 2 <= rect_map.y || position.y + size.y / 2 >= rect_map.y + rect_map.h)
@@ -123,14 +144,14 @@ public:
 	// 弾をレンダリング
 	virtual void on_render(SDL_Renderer *renderer)
 	{
-		static SDL_Point point;
+		static thread_local SDL_Point point;
 
 		// 弾のレンダリング位置を計算
 		point.x = (int)(position.x - size.x / 2);
 		point.y = (int)(position.y - size.y / 2);
 
 		// アニメーション内容をレンダリング（回転角度付き）
-		animation.on_render(renderer, point, angle_anim_rotate);
+		animation.on_render(point, angle_anim_rotate);
 	}
 
 	// 弾の衝突ロジックを処理
@@ -141,6 +162,8 @@ public:
 	}
 
 protected:
+	BulletType type = BulletType::Arrow; // 種類
+
 	Vector2 size;	  // サイズ
 	Vector2 velocity; // スピード
 	Vector2 position; // 位置
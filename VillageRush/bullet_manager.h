@@ -11,6 +11,7 @@
  * - 弾丸のリストの維持と更新
  * - 弾丸の移動、衝突検出、削除の処理
  * - 弾丸のレンダリング
+ * - 種類ごとのオブジェクトプールによる弾丸の再利用（毎刻みのヒープ確保を避ける）
  *
  * 使用方法:
  * - BulletManager::instance()->create_bullet() を使用して新しい弾丸を生成
@@ -25,6 +26,9 @@
 #include "arrow_bullet.h"
 #include "axe_bullet.h"
 #include "shell_bullet.h"
+#include "object_pool.h"
+#include "profile_manager.h"
+#include "sprite_batch_manager.h"
 
 #include <vector>
 
@@ -40,6 +44,8 @@ public:
 	/* データの更新 */
 	void on_update(double delta)
 	{
+		PROFILE_ZONE("BulletManager::on_update");
+
 		// すべての弾をループし、on_updateメソッドを呼び出す
 		for (Bullet *bullet : bullet_list)
 		{
@@ -49,27 +55,35 @@ public:
 		// 削除可能な弾を取り除く
 		bullet_list.erase(std::remove_if(
 							  bullet_list.begin(), bullet_list.end(),
-							  [](const Bullet *bullet)
+							  [&](Bullet *bullet)
 							  {
 								  // 弾が削除可能かチェック
 								  bool deletable = bullet->can_remove();
 								  if (deletable)
 								  {
-									  delete bullet; // （可能な場合）弾を削除してメモリを解放
+									  release_bullet(bullet); // （可能な場合）弾をオブジェクトプールに返却
 								  }
 								  return deletable; // 削除可能かどうかのブール値を返す
 							  }),
 						  bullet_list.end());
+
+		PROFILE_COUNTER("BulletManager::num_pool_chunk_alloc", pool_arrow.get_num_chunk_alloc() + pool_axe.get_num_chunk_alloc() + pool_shell.get_num_chunk_alloc());
+		PROFILE_COUNTER("BulletManager::num_pooled", pool_arrow.get_num_object() + pool_axe.get_num_object() + pool_shell.get_num_object());
 	}
 
 	/* レンダリングの更新 */
 	void on_render(SDL_Renderer *renderer)
 	{
+		PROFILE_ZONE("BulletManager::on_render");
+
 		// すべての弾をループし、on_renderメソッドを呼び出してレンダリング
 		for (Bullet *bullet : bullet_list)
 		{
 			bullet->on_render(renderer);
 		}
+
+		// 種類（テクスチャ）ごとにまとめて描画
+		SpriteBatchManager::instance()->flush(renderer);
 	}
 
 	BulletList &get_bullet_list()
@@ -80,25 +94,9 @@ public:
 	/* 弾のスポーン */
 	void spawn_bullet(BulletType type, const Vector2 &position, const Vector2 &velocity, double damage)
 	{
-		// 新しくスポーンされた弾のポインタを保存
-		Bullet *bullet = nullptr;
-
-		// タイプに応じて異なる弾をスポーン
-		switch (type)
-		{
-		case Arrow:
-			bullet = new ArrowBullet();
-			break;
-		case Axe:
-			bullet = new AxeBullet();
-			break;
-		case Shell:
-			bullet = new ShellBullet();
-			break;
-		default:
-			bullet = new ArrowBullet();
-			break;
-		}
+		// タイプに応じたオブジェクトプールから弾を取り出し、生成直後の状態に戻す
+		Bullet *bullet = acquire_bullet(type);
+		bullet->reset();
 
 		bullet->set_position(position);						// 弾の初期位置を設定
 		bullet->set_velocity_and_rotation(velocity);	// 弾のスピードを設定
@@ -108,20 +106,76 @@ public:
 	};
 
 private:
-	BulletManager() = default;
-
-	/* デストラクタ、弾のインスタンスを削除するために使用 */
-	~BulletManager()
+	// 弾の種類ごとのアニメーションクリップを作成（リソースの読み込み後、最初の生成より前に一度だけ）
+	BulletManager()
+		: clip_arrow(ArrowBullet::create_clip()),
+		  clip_axe(AxeBullet::create_clip()),
+		  clip_shell(ShellBullet::create_clip()),
+		  clip_shell_explode(ShellBullet::create_clip_explode())
 	{
-		for (Bullet *bullet : bullet_list)
-		{
-			delete bullet;
-		}
-	};
+	}
+
+	/* デストラクタ、弾のインスタンスはオブジェクトプールと共に解放される */
+	~BulletManager() = default;
 
 private:
 	// 生成されたすべての弾のインスタンスを格納
 	BulletList bullet_list;
+
+	// 種類ごとの弾のオブジェクトプール
+	ObjectPool<ArrowBullet> pool_arrow;
+	ObjectPool<AxeBullet> pool_axe;
+	ObjectPool<ShellBullet> pool_shell;
+
+	// 弾の種類ごとのアニメーションクリップ（同じ種類のすべての弾で共有）
+	const AnimationClip clip_arrow;
+	const AnimationClip clip_axe;
+	const AnimationClip clip_shell;
+	const AnimationClip clip_shell_explode;
+
+private:
+	// タイプに応じたオブジェクトプールから弾を取り出し、種類ごとのアニメーションクリップを設定
+	Bullet *acquire_bullet(BulletType type)
+	{
+		switch (type)
+		{
+		case Axe:
+		{
+			AxeBullet *bullet = pool_axe.acquire();
+			bullet->set_clip(&clip_axe);
+			return bullet;
+		}
+		case Shell:
+		{
+			ShellBullet *bullet = pool_shell.acquire();
+			bullet->set_clip(&clip_shell);
+			bullet->set_clip_explode(&clip_shell_explode);
+			return bullet;
+		}
+		default:
+		{
+			ArrowBullet *bullet = pool_arrow.acquire();
+			bullet->set_clip(&clip_arrow);
+			return bullet;
+		}
+		}
+	}
+
+	void release_bullet(Bullet *bullet)
+	{
+		switch (bullet->get_type())
+		{
+		case Axe:
+			pool_axe.release(static_cast<AxeBullet *>(bullet));
+			break;
+		case Shell:
+			pool_shell.release(static_cast<ShellBullet *>(bullet));
+			break;
+		default:
+			pool_arrow.release(static_cast<ArrowBullet *>(bullet));
+			break;
+		}
+	}
 };
 
 #endif // !_BULLET_MANAGER_H_
@@ -8,7 +8,7 @@
  *
  * 主な機能:
  * - コインの増加と減少の管理
- * - コインプロップ（視覚的表現）のリスト管理
+ * - コインプロップ（視覚的表現）のリスト管理（オブジェクトプールで再利用）
  * - コインプロップの更新とレンダリング
  *
  * 使用方法:
@@ -22,9 +22,14 @@
 #include "manager.h"
 #include "coin_prop.h"
 #include "config_manager.h"
+#include "resources_manager.h"
+#include "object_pool.h"
+#include "profile_manager.h"
+#include "sprite_batch_manager.h"
 
 #include <vector>
 #include <SDL.h>
+#include <algorithm>
 // コインマネージャークラス：コインの管理を行う
 class CoinManager : public Manager<CoinManager>
 {
@@ -52,6 +57,8 @@ public:
 	// 更新処理
 	void on_update(double delta)
 	{
+		PROFILE_ZONE("CoinManager::on_update");
+
 		// 全てのコインプロップを更新
 		for (CoinProp *coin_prop : coin_prop_list)
 		{
@@ -60,25 +67,36 @@ public:
 
 		// 削除可能なコインプロップを除去
 		coin_prop_list.erase(std::remove_if(coin_prop_list.begin(), coin_prop_list.end(),
-											[](CoinProp *coin_prop)
+											[&](CoinProp *coin_prop)
 											{
 												bool deletable = coin_prop->can_remove();
 												if (deletable)
 												{
-													return deletable;
+													coin_prop->on_remove();
+													coin_prop_pool.release(coin_prop); // オブジェクトプールに返却
 												}
+												return deletable;
 											}),
 							 coin_prop_list.end());
+
+		PROFILE_COUNTER("CoinManager::num_pool_chunk_alloc", coin_prop_pool.get_num_chunk_alloc());
+		PROFILE_COUNTER("CoinManager::num_pooled", coin_prop_pool.get_num_object());
 	}
 
 	// レンダリング処理
 	void on_render(SDL_Renderer *renderer)
 	{
-		// 全てのコインプロップを描画
+		PROFILE_ZONE("CoinManager::on_render");
+
+		// リソースマネージャーからコインのテクスチャを取得し、全てのコインプロップを描画
+		const TextureRegion region_coin = ResourcesManager::instance()->find_region(ResID::Tex_Coin);
 		for (CoinProp *coin_prop : coin_prop_list)
 		{
-			coin_prop->on_render(renderer);
+			coin_prop->on_render(renderer, region_coin);
 		}
+
+		// すべてのコインを1回の呼び出しで描画
+		SpriteBatchManager::instance()->flush(renderer);
 	}
 
 	// 現在のコイン数を取得
@@ -96,7 +114,8 @@ public:
 	// 新しいコインプロップを生成
 	void spawn_coin_prop(const Vector2 &position)
 	{
-		CoinProp *coin_prop = new CoinProp();
+		CoinProp *coin_prop = coin_prop_pool.acquire();
+		coin_prop->reset();
 		coin_prop->set_position(position);
 
 		coin_prop_list.push_back(coin_prop);
@@ -109,18 +128,13 @@ protected:
 		num_coin = ConfigManager::instance()->num_initial_coin;
 	};
 
-	// デストラクタ：全てのコインプロップを削除
-	~CoinManager()
-	{
-		for (CoinProp *coin_prop : coin_prop_list)
-		{
-			delete coin_prop;
-		}
-	};
+	// デストラクタ：コインプロップはオブジェクトプールと共に解放される
+	~CoinManager() = default;
 
 private:
 	double num_coin = 0;		 // コイン数
 	CoinPropList coin_prop_list; // コインプロップのリスト
+	ObjectPool<CoinProp> coin_prop_pool; // コインプロップのオブジェクトプール
 };
 
 #endif // !_COIN_MANAGER_H_
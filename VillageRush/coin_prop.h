@@ -3,8 +3,10 @@
 
 #include "tile.h"
 #include "vector2.h"
-#include "timer.h"
+#include "timer_manager.h"
 #include "resources_manager.h"
+#include "random_manager.h"
+#include "sprite_batch_manager.h"
 
 #include <SDL.h>
 
@@ -30,13 +32,32 @@ public:
 				is_valid = false; // コインが無効になり、削除待ち
 			});
 
-		// 速度を初期化、左右のどちらかをランダムに選択
-		velocity.x = (rand() % 2 ? 1 : -1) * 2 * SIZE_TILE;
-		velocity.y = -3 * SIZE_TILE;
 	};
 
 	~CoinProp() = default;
 
+	// 生成直後の状態に戻す（オブジェクトプールから取り出すたびに呼び出す）
+	void reset()
+	{
+		timer_jump.restart();
+		timer_disappear.restart();
+
+		is_valid = true;
+		is_jumping = true;
+		pass_time = 0;
+
+		// 速度を初期化、左右のどちらかをランダムに選択（プレイヤーが拾えるかに影響するため、ゲームプレイ用の乱数列を使用）
+		velocity.x = (RandomManager::instance()->gameplay_int(2) ? 1 : -1) * 2 * SIZE_TILE;
+		velocity.y = -3 * SIZE_TILE;
+	}
+
+	// 削除時にタイマーを停止（オブジェクトプールに返却されたコインのコールバックが呼び出されないようにする）
+	void on_remove()
+	{
+		timer_jump.stop();
+		timer_disappear.stop();
+	}
+
 	void set_position(const Vector2 &position)
 	{
 		this->position = position;
@@ -64,9 +85,8 @@ public:
 
 	void on_update(double delta)
 	{
-		// タイマーを更新
-		timer_jump.on_update(delta);
-		timer_disappear.on_update(delta);
+		// タイマーは TimerManager が更新する
+		pass_time += delta;
 
 		if (is_jumping)
 		{
@@ -77,40 +97,39 @@ public:
 		{
 			// 浮遊中は水平速度が0、垂直速度は上下の浮遊をシミュレート
 			velocity.x = 0;
-			velocity.y = sin(SDL_GetTicks64() / 1000 * 4) * 30 * delta;
+			// （実時間ではなく経過時間を使用し、同じシードで同じ結果を再現できるようにする）
+			velocity.y = sin(pass_time * 4) * 30 * delta;
 		}
 
 		position += velocity * delta;
 	}
 
-	void on_render(SDL_Renderer *renderer)
+	// region_coin はコインのテクスチャ（CoinManager が描画ごとに一度だけ取得する）
+	void on_render(SDL_Renderer *renderer, const TextureRegion &region_coin)
 	{
 		// レンダリング領域の矩形を定義
-		static SDL_Rect rect = {0, 0, (int)size.x, (int)size.y};
+		static thread_local SDL_Rect rect = {0, 0, (int)size.x, (int)size.y};
 
-		// リソースマネージャーからコインのテクスチャを取得
-		static SDL_Texture *tex_coin = ResourcesManager::instance()
-										   ->get_texture_pool()
-										   .find(ResID::Tex_Coin)
-										   ->second;
+		SpriteBatchManager *sprite_batch = SpriteBatchManager::instance();
 
 		// レンダリング位置を設定
 		rect.x = (int)(position.x - size.x / 2);
 		rect.y = (int)(position.y - size.y / 2);
 
-		// コインのテクスチャをレンダラーに描画
-		SDL_RenderCopy(renderer, tex_coin, nullptr, &rect);
+		// コインのテクスチャをスプライトバッチに追加
+		sprite_batch->draw(region_coin.texture, &region_coin.rect, rect);
 	}
 
 private:
 	Vector2 position; // コインの位置
 	Vector2 velocity; // コインの速度（ジャンプ中|浮遊中）
 
-	Timer timer_jump;
-	Timer timer_disappear;
+	WorldTimer timer_jump;
+	WorldTimer timer_disappear;
 
 	bool is_valid = true;
 	bool is_jumping = true;
+	double pass_time = 0; // 生成されてからの経過時間(秒)
 
 	double gravity = 500;			// 重力加速度
 	double interval_jump = 0.75;	// ジャンプの持続時間(秒)
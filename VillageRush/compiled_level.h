@@ -0,0 +1,532 @@
+#ifndef _COMPILED_LEVEL_H_
+#define _COMPILED_LEVEL_H_
+
+/**
+ * @brief コンパイル済みレベルクラス
+ *
+ * このクラスは、マップ（map.csv）・レベル設定（level.json）・ゲーム設定（config.json）を解析した結果を
+ * 1つのバイナリファイルに保存し、起動時にテキストの解析と進行ルートの探索を行わずに読み込むためのクラスです。
+ * 大きなマップでは、タイルごとの文字列の分割と数値変換が読み込み時間の大部分を占めます。
+ *
+ * ファイル形式（リトルエンディアン）:
+ * - ヘッダー: "VRLV"(4) + バージョン(u16) + 予約(u16) + 元のファイル（マップ・ゲーム設定・レベル設定）の内容のハッシュ値(u64 x 3)
+ * - 基本テンプレート: タイトル(文字列) + 幅・高さ・刻みレート・追いつき上限(i32) + シード(i64)
+ * - プレイヤー・防御塔（弓兵、斧兵、銃兵）テンプレート: 各フィールドの値(f64)
+ * - 敵テンプレート: 数(u32) + 種類ごとに 名前・属性・アニメーション
+ * - ウェーブ: 数(u32) + ウェーブごとに 報酬・間隔(f64) + 生成イベントの数(u32) + 生成イベント
+ * - マップ: 幅・高さ(u32) + 行優先のタイル（地形(u16) + 装飾(i16) + 方向(下位4ビット)・特殊フラグ(上位12ビット)(u16)）
+ *   + 防御ポイント(i32 x 2)
+ * - 進行ルート: 数(u32) + 出現ポイントごとに 番号(i32) + 経路点の数(u32) + 経路点(i32 x 2)
+ *   （文字列は 長さ(u32) + 内容、整数のリストは 数(u32) + 値(i32)）
+ *
+ * 主な機能:
+ * - compile() で ConfigManager に読み込まれたレベルをファイルに保存（レベルコンパイルツールで使用）
+ * - load() でファイルを一度に読み込み、ConfigManager のマップ・ウェーブ・テンプレートを設定
+ * - check_source() で元のファイルが変更されていないかどうかを確認（アーカイブ作成ツールで使用）
+ *
+ * 注意事項:
+ * - ファイルが存在しない場合、形式が正しくない場合、マップ外の座標や存在しない敵の種類を含む場合はfalseを返し、
+ *   ConfigManager は変更しません（呼び出し側はテキスト形式のファイルから読み込む）
+ * - 元のファイルが存在する場合は内容のハッシュ値を比較し、コンパイル後に変更されていればファイルがないものとして扱います
+ *   （元のファイルを含めずに配布する場合は、コンパイル済みレベルのみで読み込めます）
+ * - 浮動小数点数はそのままの値で保存されるため、テキスト形式から読み込んだ場合とシミュレーションの結果は一致します
+ */
+
+#include "config_manager.h"
+#include "archive_manager.h"
+#include "decode_cache.h"
+
+#include <SDL.h>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+
+class CompiledLevel
+{
+public:
+	// 元のテキスト形式のファイル（既定値はゲームが読み込むパス）
+	struct SourceList
+	{
+		SourceList() : path_map("map.csv"), path_config("config.json"), path_level("level.json") {}
+
+		std::string path_map;
+		std::string path_config;
+		std::string path_level;
+	};
+
+public:
+	// ConfigManager に読み込まれたレベルをファイルに保存（元のファイルの内容のハッシュ値を記録）
+	static bool compile(const std::string &path_out, const ConfigManager &config, const SourceList &source_list = SourceList())
+	{
+		uint64_t hash_source_list[num_source] = {0};
+		for (int i = 0; i < num_source; i++)
+		{
+			if (!compute_source_hash(get_source_path(source_list, i), hash_source_list[i]))
+				return false;
+		}
+
+		Writer writer;
+
+		writer.write_data(magic, sizeof(magic));
+		writer.write_value<uint16_t>(version);
+		writer.write_value<uint16_t>(0);
+		for (uint64_t hash_source : hash_source_list)
+			writer.write_value<uint64_t>(hash_source);
+
+		// 基本 & プレイヤーテンプレート
+		const ConfigManager::BasicTemplate &basic_template = config.basic_template;
+		writer.write_string(basic_template.window_title);
+		writer.write_value<int32_t>(basic_template.window_width);
+		writer.write_value<int32_t>(basic_template.window_height);
+		writer.write_value<int32_t>(basic_template.tick_rate);
+		writer.write_value<int32_t>(basic_template.max_catch_up_ticks);
+		writer.write_value<int64_t>(basic_template.seed);
+
+		const ConfigManager::PlayerTemplate &player_template = config.player_template;
+		writer.write_value<double>(player_template.speed);
+		writer.write_value<double>(player_template.normal_attack_interval);
+		writer.write_value<double>(player_template.normal_attack_damage);
+		writer.write_value<double>(player_template.skill_interval);
+		writer.write_value<double>(player_template.skill_damage);
+
+		// 防御塔テンプレート（double の配列のみで構成されるため、そのまま書き込む）
+		static_assert(sizeof(ConfigManager::TowerTemplate) == sizeof(double) * 49, "TowerTemplate must consist of double arrays only");
+		for (const ConfigManager::TowerTemplate *tower_template : {&config.archer_template, &config.axeman_template, &config.gunner_template})
+			writer.write_data(tower_template, sizeof(ConfigManager::TowerTemplate));
+
+		// 敵テンプレート
+		writer.write_value<uint32_t>((uint32_t)config.enemy_template_list.size());
+		for (const ConfigManager::EnemyTemplate &enemy_template : config.enemy_template_list)
+		{
+			writer.write_string(enemy_template.name);
+			writer.write_value<double>(enemy_template.hp);
+			writer.write_value<double>(enemy_template.speed);
+			writer.write_value<double>(enemy_template.damage);
+			writer.write_value<double>(enemy_template.reward_ratio);
+			writer.write_value<double>(enemy_template.recover_interval);
+			writer.write_value<double>(enemy_template.recover_range);
+			writer.write_value<double>(enemy_template.recover_intensity);
+			writer.write_value<double>(enemy_template.size[0]);
+			writer.write_value<double>(enemy_template.size[1]);
+
+			writer.write_string(enemy_template.path_texture);
+			writer.write_string(enemy_template.path_texture_sketch);
+			writer.write_value<int32_t>(enemy_template.num_h);
+			writer.write_value<int32_t>(enemy_template.num_v);
+			writer.write_value<double>(enemy_template.anim_interval);
+			writer.write_int_list(enemy_template.idx_list_up);
+			writer.write_int_list(enemy_template.idx_list_down);
+			writer.write_int_list(enemy_template.idx_list_left);
+			writer.write_int_list(enemy_template.idx_list_right);
+		}
+
+		// ウェーブ
+		writer.write_value<uint32_t>((uint32_t)config.wave_list.size());
+		for (const Wave &wave : config.wave_list)
+		{
+			writer.write_value<double>(wave.rewards);
+			writer.write_value<double>(wave.interval);
+			writer.write_value<uint32_t>((uint32_t)wave.spawn_event_list.size());
+			for (const Wave::SpawnEvent &spawn_event : wave.spawn_event_list)
+			{
+				writer.write_value<double>(spawn_event.interval);
+				writer.write_value<int32_t>(spawn_event.spawn_point);
+				writer.write_value<int32_t>(spawn_event.enemy_type);
+			}
+		}
+
+		// マップ
+		const Map &map = config.map;
+		writer.write_value<uint32_t>((uint32_t)map.get_width());
+		writer.write_value<uint32_t>((uint32_t)map.get_height());
+		for (const Tile &tile : map.get_tile_map().get_tile_list())
+		{
+			writer.write_value<uint16_t>(tile.terrian);
+			writer.write_value<int16_t>(tile.decoration);
+			writer.write_value<uint16_t>(pack_flag(tile));
+		}
+		writer.write_value<int32_t>(map.get_idx_home().x);
+		writer.write_value<int32_t>(map.get_idx_home().y);
+
+		// 進行ルート（同じレベルからは同じファイルが作成されるよう、出現ポイントの番号順に並べる）
+		std::vector<int> idx_spawn_point_list;
+		for (const auto &pair : map.get_spawner_route_pool())
+			idx_spawn_point_list.push_back(pair.first);
+		std::sort(idx_spawn_point_list.begin(), idx_spawn_point_list.end());
+
+		writer.write_value<uint32_t>((uint32_t)idx_spawn_point_list.size());
+		for (int idx_spawn_point : idx_spawn_point_list)
+		{
+			const Route::IdxList &idx_list = map.get_spawner_route_pool().at(idx_spawn_point).get_idx_list();
+			writer.write_value<int32_t>(idx_spawn_point);
+			writer.write_value<uint32_t>((uint32_t)idx_list.size());
+			for (const SDL_Point &idx : idx_list)
+			{
+				writer.write_value<int32_t>(idx.x);
+				writer.write_value<int32_t>(idx.y);
+			}
+		}
+
+		std::ofstream file(path_out, std::ios::binary | std::ios::trunc);
+		if (!file.good())
+			return false;
+		file.write(writer.buffer.data(), writer.buffer.size());
+		return file.good();
+	}
+
+	// ファイルを読み込み、ConfigManager に設定（アーカイブにある場合はメモリマップされたデータから読み込む）
+	static bool load(const std::string &path, ConfigManager &config, const SourceList &source_list = SourceList())
+	{
+		std::string buffer;
+		const uint8_t *data = nullptr;
+		size_t size = 0;
+		if (!ArchiveManager::instance()->load_data(path, buffer, data, size))
+			return false;
+
+		Reader reader(data, size);
+		if (!read_header(reader, source_list))
+			return false;
+
+		// すべて読み込めた場合のみ ConfigManager に設定するため、一時変数に読み込む
+		ConfigManager::BasicTemplate basic_template;
+		reader.read_string(basic_template.window_title);
+		basic_template.window_width = reader.read_int();
+		basic_template.window_height = reader.read_int();
+		basic_template.tick_rate = reader.read_int();
+		basic_template.max_catch_up_ticks = reader.read_int();
+		int64_t seed = 0;
+		reader.read_value(seed);
+		basic_template.seed = (long long)seed;
+
+		ConfigManager::PlayerTemplate player_template;
+		reader.read_value(player_template.speed);
+		reader.read_value(player_template.normal_attack_interval);
+		reader.read_value(player_template.normal_attack_damage);
+		reader.read_value(player_template.skill_interval);
+		reader.read_value(player_template.skill_damage);
+
+		ConfigManager::TowerTemplate tower_template_list[3];
+		for (ConfigManager::TowerTemplate &tower_template : tower_template_list)
+			reader.read_data(&tower_template, sizeof(ConfigManager::TowerTemplate));
+
+		std::vector<ConfigManager::EnemyTemplate> enemy_template_list(reader.read_count(sizeof(uint32_t) + sizeof(double) * 9));
+		for (ConfigManager::EnemyTemplate &enemy_template : enemy_template_list)
+		{
+			reader.read_string(enemy_template.name);
+			reader.read_value(enemy_template.hp);
+			reader.read_value(enemy_template.speed);
+			reader.read_value(enemy_template.damage);
+			reader.read_value(enemy_template.reward_ratio);
+			reader.read_value(enemy_template.recover_interval);
+			reader.read_value(enemy_template.recover_range);
+			reader.read_value(enemy_template.recover_intensity);
+			reader.read_value(enemy_template.size[0]);
+			reader.read_value(enemy_template.size[1]);
+
+			reader.read_string(enemy_template.path_texture);
+			reader.read_string(enemy_template.path_texture_sketch);
+			enemy_template.num_h = reader.read_int();
+			enemy_template.num_v = reader.read_int();
+			reader.read_value(enemy_template.anim_interval);
+			reader.read_int_list(enemy_template.idx_list_up);
+			reader.read_int_list(enemy_template.idx_list_down);
+			reader.read_int_list(enemy_template.idx_list_left);
+			reader.read_int_list(enemy_template.idx_list_right);
+		}
+
+		std::vector<Wave> wave_list(reader.read_count(sizeof(double) * 2 + sizeof(uint32_t)));
+		for (Wave &wave : wave_list)
+		{
+			reader.read_value(wave.rewards);
+			reader.read_value(wave.interval);
+			wave.spawn_event_list.resize(reader.read_count(sizeof(double) + sizeof(int32_t) * 2));
+			for (Wave::SpawnEvent &spawn_event : wave.spawn_event_list)
+			{
+				reader.read_value(spawn_event.interval);
+				spawn_event.spawn_point = reader.read_int();
+				spawn_event.enemy_type = reader.read_int();
+			}
+		}
+
+		// マップ（行優先のタイル）
+		uint32_t width_map = 0, height_map = 0;
+		reader.read_value(width_map);
+		reader.read_value(height_map);
+		if (!reader.check_good() || width_map == 0 || height_map == 0 || !reader.check_size((uint64_t)width_map * height_map * size_tile))
+			return false;
+
+		std::vector<Tile> tile_list((size_t)width_map * height_map);
+		for (Tile &tile : tile_list)
+		{
+			uint16_t flag = 0;
+			reader.read_value(tile.terrian);
+			reader.read_value(tile.decoration);
+			reader.read_value(flag);
+			unpack_flag(tile, flag);
+		}
+		TileMap tile_map(width_map, height_map, std::move(tile_list));
+		SDL_Point idx_home = {0};
+		idx_home.x = reader.read_int();
+		idx_home.y = reader.read_int();
+
+		// 進行ルート（コンパイル時に探索済みの経路点をそのまま使用）
+		Map::SpawnerRoutePool spawner_route_pool;
+		const size_t num_route = reader.read_count(sizeof(int32_t) + sizeof(uint32_t));
+		for (size_t i = 0; i < num_route; i++)
+		{
+			const int idx_spawn_point = reader.read_int();
+			Route::IdxList idx_list(reader.read_count(sizeof(int32_t) * 2));
+			for (SDL_Point &idx : idx_list)
+			{
+				idx.x = reader.read_int();
+				idx.y = reader.read_int();
+			}
+			spawner_route_pool[idx_spawn_point] = Route(std::move(idx_list));
+		}
+
+		// 途中で切れたファイルや余分なデータのあるファイルは読み込まない
+		if (!reader.check_good() || !reader.check_rest(0))
+			return false;
+
+		// テキスト形式から読み込んだ場合と同じ条件を満たし、マップ外の座標や存在しない敵の種類を参照しないことを確認
+		if (basic_template.tick_rate <= 0 || basic_template.max_catch_up_ticks <= 0 || enemy_template_list.empty() || wave_list.empty())
+			return false;
+		for (const ConfigManager::EnemyTemplate &enemy_template : enemy_template_list)
+		{
+			if (enemy_template.num_h <= 0 || enemy_template.num_v <= 0)
+				return false;
+		}
+		for (const Wave &wave : wave_list)
+		{
+			if (wave.spawn_event_list.empty())
+				return false;
+			for (const Wave::SpawnEvent &spawn_event : wave.spawn_event_list)
+			{
+				if (spawn_event.enemy_type < 0 || spawn_event.enemy_type >= (int)enemy_template_list.size())
+					return false;
+			}
+		}
+		if (!check_idx_in_map(idx_home, width_map, height_map))
+			return false;
+		for (const auto &pair : spawner_route_pool)
+		{
+			const Route::IdxList &idx_list = pair.second.get_idx_list();
+			if (idx_list.empty())
+				return false;
+			for (const SDL_Point &idx : idx_list)
+			{
+				if (!check_idx_in_map(idx, width_map, height_map))
+					return false;
+			}
+		}
+
+		config.basic_template = basic_template;
+		config.player_template = player_template;
+		config.archer_template = tower_template_list[0];
+		config.axeman_template = tower_template_list[1];
+		config.gunner_template = tower_template_list[2];
+		config.enemy_template_list = std::move(enemy_template_list);
+		config.wave_list = std::move(wave_list);
+		config.map.set_data(std::move(tile_map), idx_home, std::move(spawner_route_pool));
+
+		return true;
+	}
+
+	// ファイルの形式が正しく、元のファイルがコンパイル後に変更されていないかどうか
+	static bool check_source(const std::string &path, const SourceList &source_list = SourceList())
+	{
+		std::string buffer;
+		const uint8_t *data = nullptr;
+		size_t size = 0;
+		if (!ArchiveManager::instance()->load_data(path, buffer, data, size))
+			return false;
+
+		Reader reader(data, size);
+		return read_header(reader, source_list);
+	}
+
+private:
+	static constexpr char magic[4] = {'V', 'R', 'L', 'V'};
+	static constexpr uint16_t version = 3;
+	static constexpr int num_source = 3; // 元のファイルの数（マップ・ゲーム設定・レベル設定）
+
+	class Reader;
+	static constexpr size_t size_tile = sizeof(uint16_t) * 3; // ファイル上の1タイルのサイズ
+
+	// 方向マーカー（下位4ビット）と特殊フラグ（上位12ビット）を1つの値にまとめる
+	// （ビットフィールドの配置はコンパイラによって異なるため、Tileをそのまま書き込まない）
+	static uint16_t pack_flag(const Tile &tile)
+	{
+		return (uint16_t)(((uint16_t)tile.direction & 0xF) | ((uint16_t)tile.special_flag << 4));
+	}
+
+	static const std::string &get_source_path(const SourceList &source_list, int idx)
+	{
+		return idx == 0 ? source_list.path_map : (idx == 1 ? source_list.path_config : source_list.path_level);
+	}
+
+	// ファイルの内容のハッシュ値を計算（アーカイブにある場合はアーカイブ内のファイル、読み込めない場合はfalse）
+	static bool compute_source_hash(const std::string &path, uint64_t &hash)
+	{
+		std::string buffer;
+		const uint8_t *data = nullptr;
+		size_t size = 0;
+		if (!ArchiveManager::instance()->load_data(path, buffer, data, size))
+			return false;
+
+		hash = DecodeCache::compute_hash(data, size);
+		return true;
+	}
+
+	// ヘッダーを読み込み、形式と元のファイルのハッシュ値を確認（元のファイルが存在しない場合は比較しない）
+	static bool read_header(Reader &reader, const SourceList &source_list)
+	{
+		char magic_file[4] = {0};
+		uint16_t version_file = 0, reserved = 0;
+		reader.read_data(magic_file, sizeof(magic_file));
+		reader.read_value(version_file);
+		reader.read_value(reserved);
+		if (!reader.check_good() || std::memcmp(magic_file, magic, sizeof(magic)) != 0 || version_file != version)
+			return false;
+
+		for (int i = 0; i < num_source; i++)
+		{
+			uint64_t hash_file = 0, hash_source = 0;
+			reader.read_value(hash_file);
+			if (!reader.check_good())
+				return false;
+			if (compute_source_hash(get_source_path(source_list, i), hash_source) && hash_source != hash_file)
+				return false;
+		}
+
+		return true;
+	}
+
+	static bool check_idx_in_map(const SDL_Point &idx, uint32_t width_map, uint32_t height_map)
+	{
+		return idx.x >= 0 && idx.y >= 0 && (uint32_t)idx.x < width_map && (uint32_t)idx.y < height_map;
+	}
+
+	static void unpack_flag(Tile &tile, uint16_t flag)
+	{
+		tile.direction = (Tile::Direction)(flag & 0xF);
+		tile.special_flag = (int16_t)((int16_t)flag >> 4); // 算術シフトで符号を復元
+	}
+
+	// メモリ上のバッファに値を書き込む
+	struct Writer
+	{
+		std::string buffer;
+
+		void write_data(const void *data, size_t size)
+		{
+			buffer.append((const char *)data, size);
+		}
+
+		template <typename T>
+		void write_value(T val)
+		{
+			write_data(&val, sizeof(T));
+		}
+
+		void write_string(const std::string &str)
+		{
+			write_value<uint32_t>((uint32_t)str.size());
+			write_data(str.data(), str.size());
+		}
+
+		void write_int_list(const std::vector<int> &list)
+		{
+			write_value<uint32_t>((uint32_t)list.size());
+			for (int val : list)
+				write_value<int32_t>(val);
+		}
+	};
+
+	// メモリ上のデータから値を読み込む（範囲外を読み込もうとした以降は失敗状態になり、値は0のまま）
+	class Reader
+	{
+	public:
+		Reader(const uint8_t *data, size_t size) : data(data), size(size) {}
+
+		bool check_good() const
+		{
+			return is_good;
+		}
+
+		// 残りのサイズが期待どおりかどうか
+		bool check_rest(uint64_t size_expected) const
+		{
+			return is_good && (uint64_t)(size - pos) == size_expected;
+		}
+
+		// 残りのサイズが指定したサイズ以上かどうか
+		bool check_size(uint64_t size_min) const
+		{
+			return is_good && (uint64_t)(size - pos) >= size_min;
+		}
+
+		void read_data(void *dst, size_t size_read)
+		{
+			if (!is_good || size_read > size - pos)
+			{
+				is_good = false;
+				return;
+			}
+
+			std::memcpy(dst, data + pos, size_read);
+			pos += size_read;
+		}
+
+		template <typename T>
+		void read_value(T &val)
+		{
+			read_data(&val, sizeof(T));
+		}
+
+		int read_int()
+		{
+			int32_t val = 0;
+			read_value(val);
+			return (int)val;
+		}
+
+		// 要素数を読み込む（壊れたファイルで巨大な配列を確保しないよう、1要素あたりの最小サイズで残りのサイズと比較）
+		size_t read_count(size_t size_min_element)
+		{
+			uint32_t count = 0;
+			read_value(count);
+			if (is_good && (uint64_t)count * size_min_element > size - pos)
+				is_good = false;
+			return is_good ? (size_t)count : 0;
+		}
+
+		void read_string(std::string &str)
+		{
+			const size_t length = read_count(1);
+			if (!is_good)
+				return;
+
+			str.assign((const char *)data + pos, length);
+			pos += length;
+		}
+
+		void read_int_list(std::vector<int> &list)
+		{
+			list.resize(read_count(sizeof(int32_t)));
+			for (int &val : list)
+				val = read_int();
+		}
+
+	private:
+		const uint8_t *data = nullptr;
+		size_t size = 0;
+		size_t pos = 0;
+		bool is_good = true;
+	};
+};
+
+#endif // !_COMPILED_LEVEL_H_
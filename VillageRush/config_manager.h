@@ -22,10 +22,14 @@
 #include "map.h"
 #include "manager.h"
 #include "wave.h"
+#include "archive_manager.h"
 
 #include <SDL.h>
 #include <string>
+#include <vector>
 #include <cJSON.h>
+#include <cctype>
+#include <cstdlib>
 #include <fstream>
 #include <sstream>
 #include <iostream>
@@ -42,6 +46,9 @@ public:
 		std::string window_title = u8"ヴィレッジラッシュ";
 		int window_width = 1280;
 		int window_height = 720;
+		int tick_rate = 60;			 // シミュレーションの固定刻みレート（Hz）
+		int max_catch_up_ticks = 5; // 1フレームで実行する刻み数の上限（処理落ち時の追いつき上限）
+		long long seed = -1;		 // 乱数シード（負の場合は起動ごとにランダム）
 	};
 
 	// プレイヤーテンプレート
@@ -64,9 +71,10 @@ public:
 		double upgrade_cost[9] = {75}; // アップグレードコスト
 	};
 
-	// 敵テンプレート
+	// 敵テンプレート（敵の種類ごとの属性とアニメーション）
 	struct EnemyTemplate
 	{
+		std::string name;			   // 設定ファイル上の名前（"king_slim"など）
 		double hp = 100;			   // 体力
 		double speed = 1;			   // 敵のスピード
 		double damage = 1;			   // 防御ポイントへのダメージ
@@ -74,6 +82,17 @@ public:
 		double recover_interval = 10;  // 回復間隔
 		double recover_range = 0;	   // 回復範囲
 		double recover_intensity = 25; // 回復強度
+		double size[2] = {48, 48};	   // 当たり判定と描画のサイズ
+
+		// アニメーション
+		std::string path_texture;		 // テクスチャのパス
+		std::string path_texture_sketch; // シルエット（被弾時）テクスチャのパス
+		int num_h = 1, num_v = 1;		 // テクスチャの水平・垂直方向のフレーム数
+		double anim_interval = 0.1;		 // フレームの間隔
+		std::vector<int> idx_list_up;	 // 各方向のフレームのインデックス
+		std::vector<int> idx_list_down;
+		std::vector<int> idx_list_left;
+		std::vector<int> idx_list_right;
 	};
 
 public:
@@ -89,6 +108,9 @@ public:
 	bool is_game_win = true;
 	bool is_game_over = false;
 
+	// ヘッドレスモード（ウィンドウ・レンダラー・オーディオを使用せず、シミュレーションのみを実行）
+	bool is_headless = false;
+
 	// タイルマップテクスチャ生成後の境界矩形
 	SDL_Rect rect_tile_map = {0};
 
@@ -101,12 +123,8 @@ public:
 	TowerTemplate axeman_template;
 	TowerTemplate gunner_template;
 
-	// 敵テンプレート
-	EnemyTemplate slim_template;
-	EnemyTemplate king_slim_template;
-	EnemyTemplate skeleton_template;
-	EnemyTemplate goblin_template;
-	EnemyTemplate goblin_priest_template;
+	// 敵テンプレート（設定ファイルの記述順、インデックスが敵の種類を表す）
+	std::vector<EnemyTemplate> enemy_template_list;
 
 	// ゲーム開始時のデータ
 	const double num_initial_hp = 10;
@@ -119,8 +137,8 @@ public:
 	{
 		/*解析前のチェック操作*/
 
-		// ファイルを開き、正常に開けたかチェック
-		std::ifstream file(path);
+		// ファイルを開き、正常に開けたかチェック（アーカイブがある場合はアーカイブ内のファイル）
+		AssetStream file(path);
 		if (!file.good())
 		{
 			return false;
@@ -137,19 +155,13 @@ public:
 		// JSONの解析に失敗した場合、またはルート要素が配列でない場合は失敗を返す
 		if (!json_root)
 		{
-			SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_ERROR,
-									 u8"エラー",
-									 u8"レベル設定の読み込み：JSONファイルの解析に失敗しました",
-									 nullptr);
+			report_error(u8"レベル設定の読み込み：JSONファイルの解析に失敗しました");
 			cJSON_Delete(json_root);
 			return false;
 		}
 		if (json_root->type != cJSON_Array)
 		{
-			SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_ERROR,
-									 u8"エラー",
-									 u8"レベル設定の読み込み：JSONデータタイプが配列ではありません",
-									 nullptr);
+			report_error(u8"レベル設定の読み込み：JSONデータタイプが配列ではありません");
 			cJSON_Delete(json_root);
 			return false;
 		}
@@ -206,18 +218,15 @@ public:
 					cJSON *json_spawn_event_enemy_type = cJSON_GetObjectItem(json_spawn_event, "enemy");
 					if (json_spawn_event_enemy_type && json_spawn_event_enemy_type->type == cJSON_String)
 					{
-						// 対応する列挙値をマッチング
-						const std::string str_enemy_type = json_spawn_event_enemy_type->valuestring;
-						if (str_enemy_type == "Slim")
-							spawn_event.enemy_type = EnemyType::Slim;
-						else if (str_enemy_type == "KingSlim")
-							spawn_event.enemy_type = EnemyType::KingSlim;
-						else if (str_enemy_type == "Skeleton")
-							spawn_event.enemy_type = EnemyType::Skeleton;
-						else if (str_enemy_type == "Goblin")
-							spawn_event.enemy_type = EnemyType::Goblin;
-						else if (str_enemy_type == "GoblinPriest")
-							spawn_event.enemy_type = EnemyType::GoblinPriest;
+						// 対応する敵テンプレートをマッチング（見つからない場合は名前の誤りとみなし、読み込みに失敗する）
+						int enemy_type = find_enemy_type(json_spawn_event_enemy_type->valuestring);
+						if (enemy_type < 0)
+						{
+							report_error(std::string(u8"レベル設定の読み込み：不明な敵の種類です：") + json_spawn_event_enemy_type->valuestring);
+							cJSON_Delete(json_root);
+							return false;
+						}
+						spawn_event.enemy_type = enemy_type;
 					}
 				}
 				// このウェーブの生成イベントリストが空の場合、このウェーブを削除
@@ -231,10 +240,7 @@ public:
 		// ウェーブリストが空の場合、読み込みに失敗したとみなしfalseを返す
 		if (wave_list.empty())
 		{
-			SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_ERROR,
-									 u8"エラー",
-									 u8"レベル設定の読み込み：ウェーブリストが空です",
-									 nullptr);
+			report_error(u8"レベル設定の読み込み：ウェーブリストが空です");
 			return false;
 		}
 
@@ -244,15 +250,12 @@ public:
 
 	bool load_game_config(const std::string &path)
 	{
-		// ファイルを開き、正常に開けたかチェック
-		std::ifstream file(path);
+		// ファイルを開き、正常に開けたかチェック（アーカイブがある場合はアーカイブ内のファイル）
+		AssetStream file(path);
 		// ファイルが開けなかった場合、falseを返す
 		if (!file.good())
 		{
-			SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_ERROR,
-									 u8"エラー",
-									 u8"ゲーム設定の読み込み：設定ファイルを開けません",
-									 nullptr);
+			report_error(u8"ゲーム設定の読み込み：設定ファイルを開けません");
 			return false;
 		}
 
@@ -267,10 +270,7 @@ public:
 		// JSONの解析に失敗した場合、またはルート要素がJSONオブジェクトでない場合はfalseを返す
 		if (!json_root || json_root->type != cJSON_Object)
 		{
-			SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_ERROR,
-									 u8"エラー",
-									 u8"ゲーム設定の読み込み：JSONの解析に失敗したか、ルート要素がJSONオブジェクトではありません",
-									 nullptr);
+			report_error(u8"ゲーム設定の読み込み：JSONの解析に失敗したか、ルート要素がJSONオブジェクトではありません");
 			return false;
 		}
 
@@ -283,10 +283,7 @@ public:
 		// これらの子オブジェクトが正常に取得され、タイプが正しいかチェック。エラーがある場合、JSONオブジェクトを削除しfalseを返す
 		if (!json_basic || !json_player || !json_tower || !json_enemy || json_basic->type != cJSON_Object || json_player->type != cJSON_Object || json_tower->type != cJSON_Object || json_enemy->type != cJSON_Object)
 		{
-			SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_ERROR,
-									 u8"エラー",
-									 u8"ゲーム設定の読み込み：子オブジェクトのチェック中にエラーが発生しました",
-									 nullptr);
+			report_error(u8"ゲーム設定の読み込み：子オブジェクトのチェック中にエラーが発生しました");
 			cJSON_Delete(json_root);
 			return false;
 		}
@@ -299,22 +296,215 @@ public:
 		parse_tower_template(axeman_template, cJSON_GetObjectItem(json_tower, "axeman"));
 		parse_tower_template(gunner_template, cJSON_GetObjectItem(json_tower, "gunner"));
 
-		parse_enemy_template(slim_template, cJSON_GetObjectItem(json_enemy, "slim"));
-		parse_enemy_template(king_slim_template, cJSON_GetObjectItem(json_enemy, "king_slim"));
-		parse_enemy_template(skeleton_template, cJSON_GetObjectItem(json_enemy, "skeleton"));
-		parse_enemy_template(goblin_template, cJSON_GetObjectItem(json_enemy, "goblin"));
-		parse_enemy_template(goblin_priest_template, cJSON_GetObjectItem(json_enemy, "goblin_priest"));
+		// 敵の種類は設定ファイルに記述されたすべてのオブジェクト（新しい種類の追加に再コンパイルは不要）
+		enemy_template_list.clear();
+		cJSON *json_enemy_template = nullptr;
+		cJSON_ArrayForEach(json_enemy_template, json_enemy)
+		{
+			if (json_enemy_template->type != cJSON_Object)
+				continue;
+
+			enemy_template_list.emplace_back();
+			enemy_template_list.back().name = json_enemy_template->string;
+			parse_enemy_template(enemy_template_list.back(), json_enemy_template);
+		}
 
-		// 解析完了後、JSONファイルを閉じ、trueを返す
+		// 解析完了後、JSONファイルを閉じる
 		cJSON_Delete(json_root);
+
+		if (enemy_template_list.empty())
+		{
+			report_error(u8"ゲーム設定の読み込み：敵の種類が定義されていません");
+			return false;
+		}
+
 		return true;
 	}
 
+	/*
+	 * 敵の名前から敵の種類（enemy_template_listのインデックス）を検索し、見つからない場合は-1を返す
+	 * 設定ファイル上の名前（"king_slim"）と、レベル設定で使用する名前（"KingSlim"）のどちらでも指定できる
+	 */
+	int find_enemy_type(const std::string &name) const
+	{
+		// "KingSlim" -> "king_slim" のように変換
+		std::string name_snake;
+		for (size_t i = 0; i < name.size(); i++)
+		{
+			if (isupper((unsigned char)name[i]))
+			{
+				if (i > 0)
+					name_snake += '_';
+				name_snake += (char)tolower((unsigned char)name[i]);
+			}
+			else
+				name_snake += name[i];
+		}
+
+		for (size_t i = 0; i < enemy_template_list.size(); i++)
+		{
+			if (enemy_template_list[i].name == name || enemy_template_list[i].name == name_snake)
+				return (int)i;
+		}
+		return -1;
+	}
+
+	/*マップのサイズに基づいてタイルマップの境界矩形を計算し、ウィンドウ中央に配置する*/
+	void update_rect_tile_map()
+	{
+		rect_tile_map.w = (int)map.get_width() * SIZE_TILE;
+		rect_tile_map.h = (int)map.get_height() * SIZE_TILE;
+		rect_tile_map.x = (basic_template.window_width - rect_tile_map.w) / 2;
+		rect_tile_map.y = (basic_template.window_height - rect_tile_map.h) / 2;
+	}
+
+	/*
+	 * 設定ファイルのキーパスで指定した設定値を上書きし、キーが不正な場合はfalseを返す
+	 * キーの例："player.speed"、"enemy.slim.hp"、"tower.archer.damage"（全レベルに適用）、"tower.archer.damage.3"（レベル指定）
+	 */
+	bool set_config_value(const std::string &key, double val)
+	{
+		// キーを「.」で区切る
+		std::vector<std::string> part_list;
+		std::stringstream str_stream(key);
+		std::string str_part;
+		while (std::getline(str_stream, str_part, '.'))
+			part_list.push_back(str_part);
+
+		if (part_list.size() == 2 && part_list[0] == "player")
+		{
+			double *field = find_player_field(part_list[1]);
+			if (!field)
+				return false;
+			*field = val;
+			return true;
+		}
+
+		if (part_list.size() == 3 && part_list[0] == "enemy")
+		{
+			EnemyTemplate *tpl = find_enemy_template(part_list[1]);
+			double *field = tpl ? find_enemy_field(*tpl, part_list[2]) : nullptr;
+			if (!field)
+				return false;
+			*field = val;
+			return true;
+		}
+
+		if ((part_list.size() == 3 || part_list.size() == 4) && part_list[0] == "tower")
+		{
+			TowerTemplate *tpl = find_tower_template(part_list[1]);
+			int num_level = 0;
+			double *field = tpl ? find_tower_field(*tpl, part_list[2], num_level) : nullptr;
+			if (!field)
+				return false;
+
+			// レベルの指定がない場合は全レベルに適用
+			if (part_list.size() == 3)
+			{
+				for (int i = 0; i < num_level; i++)
+					field[i] = val;
+				return true;
+			}
+
+			char *str_end = nullptr;
+			long idx_level = std::strtol(part_list[3].c_str(), &str_end, 10);
+			if (*str_end != '\0' || idx_level < 0 || idx_level >= num_level)
+				return false;
+			field[idx_level] = val;
+			return true;
+		}
+
+		return false;
+	}
+
 protected:
 	ConfigManager() = default;
 	~ConfigManager() = default;
 
 private:
+	// エラーメッセージの表示（ヘッドレスモードではメッセージボックスを表示できないため、標準エラー出力に表示）
+	void report_error(const std::string &err_msg) const
+	{
+		if (is_headless)
+			std::cerr << u8"エラー: " << err_msg << std::endl;
+		else
+			SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_ERROR, u8"エラー", err_msg.c_str(), nullptr);
+	}
+
+	/*set_config_value()で使用する、キー名からテンプレートとフィールドを検索する関数群*/
+	double *find_player_field(const std::string &name)
+	{
+		if (name == "speed")
+			return &player_template.speed;
+		if (name == "normal_attack_interval")
+			return &player_template.normal_attack_interval;
+		if (name == "normal_attack_damage")
+			return &player_template.normal_attack_damage;
+		if (name == "skill_interval")
+			return &player_template.skill_interval;
+		if (name == "skill_damage")
+			return &player_template.skill_damage;
+		return nullptr;
+	}
+
+	EnemyTemplate *find_enemy_template(const std::string &name)
+	{
+		for (EnemyTemplate &tpl : enemy_template_list)
+		{
+			if (tpl.name == name)
+				return &tpl;
+		}
+		return nullptr;
+	}
+
+	double *find_enemy_field(EnemyTemplate &tpl, const std::string &name)
+	{
+		if (name == "hp")
+			return &tpl.hp;
+		if (name == "speed")
+			return &tpl.speed;
+		if (name == "damage")
+			return &tpl.damage;
+		if (name == "reward_ratio")
+			return &tpl.reward_ratio;
+		if (name == "recover_interval")
+			return &tpl.recover_interval;
+		if (name == "recover_range")
+			return &tpl.recover_range;
+		if (name == "recover_intensity")
+			return &tpl.recover_intensity;
+		return nullptr;
+	}
+
+	TowerTemplate *find_tower_template(const std::string &name)
+	{
+		if (name == "archer")
+			return &archer_template;
+		if (name == "axeman")
+			return &axeman_template;
+		if (name == "gunner")
+			return &gunner_template;
+		return nullptr;
+	}
+
+	// 防御塔のフィールドは配列のため、要素数（レベル数）も返す
+	double *find_tower_field(TowerTemplate &tpl, const std::string &name, int &num_level)
+	{
+		num_level = 10;
+		if (name == "interval")
+			return tpl.interval;
+		if (name == "damage")
+			return tpl.damage;
+		if (name == "view_range")
+			return tpl.view_range;
+		if (name == "cost")
+			return tpl.cost;
+		num_level = 9;
+		if (name == "upgrade_cost")
+			return tpl.upgrade_cost;
+		return nullptr;
+	}
+
 	void parse_basic_template(BasicTemplate &tpl, cJSON *json_root)
 	{
 		// json_rootがnullでなく、JSONオブジェクトであることを確認。条件を満たさない場合は関数を終了。
@@ -325,6 +515,9 @@ private:
 		cJSON *json_window_title = cJSON_GetObjectItem(json_root, "window_title");
 		cJSON *json_window_width = cJSON_GetObjectItem(json_root, "window_width");
 		cJSON *json_window_height = cJSON_GetObjectItem(json_root, "window_height");
+		cJSON *json_tick_rate = cJSON_GetObjectItem(json_root, "tick_rate");
+		cJSON *json_max_catch_up_ticks = cJSON_GetObjectItem(json_root, "max_catch_up_ticks");
+		cJSON *json_seed = cJSON_GetObjectItem(json_root, "seed");
 
 		// 正常に取得でき、かつ型が正しい場合、tpl構造体の対応するメンバ変数に値を代入
 		if (json_window_title && json_window_title->type == cJSON_String)
@@ -333,6 +526,13 @@ private:
 			tpl.window_width = json_window_width->valueint;
 		if (json_window_height && json_window_height->type == cJSON_Number)
 			tpl.window_height = json_window_height->valueint;
+		// 刻みレートと追いつき上限は1以上のみ有効
+		if (json_tick_rate && json_tick_rate->type == cJSON_Number && json_tick_rate->valueint > 0)
+			tpl.tick_rate = json_tick_rate->valueint;
+		if (json_max_catch_up_ticks && json_max_catch_up_ticks->type == cJSON_Number && json_max_catch_up_ticks->valueint > 0)
+			tpl.max_catch_up_ticks = json_max_catch_up_ticks->valueint;
+		if (json_seed && json_seed->type == cJSON_Number)
+			tpl.seed = (long long)json_seed->valuedouble;
 	}
 
 	void parse_player_template(PlayerTemplate &tpl, cJSON *json_root)
@@ -434,6 +634,49 @@ private:
 			tpl.recover_range = json_recover_range->valuedouble;
 		if (json_recover_intensity && json_recover_intensity->type == cJSON_Number)
 			tpl.recover_intensity = json_recover_intensity->valuedouble;
+
+		parse_number_array(tpl.size, 2, cJSON_GetObjectItem(json_root, "size"));
+
+		// アニメーションの解析
+		cJSON *json_animation = cJSON_GetObjectItem(json_root, "animation");
+		if (!json_animation || json_animation->type != cJSON_Object)
+			return;
+
+		cJSON *json_texture = cJSON_GetObjectItem(json_animation, "texture");
+		cJSON *json_texture_sketch = cJSON_GetObjectItem(json_animation, "texture_sketch");
+		cJSON *json_num_h = cJSON_GetObjectItem(json_animation, "num_h");
+		cJSON *json_num_v = cJSON_GetObjectItem(json_animation, "num_v");
+		cJSON *json_interval = cJSON_GetObjectItem(json_animation, "interval");
+
+		if (json_texture && json_texture->type == cJSON_String)
+			tpl.path_texture = json_texture->valuestring;
+		if (json_texture_sketch && json_texture_sketch->type == cJSON_String)
+			tpl.path_texture_sketch = json_texture_sketch->valuestring;
+		if (json_num_h && json_num_h->type == cJSON_Number && json_num_h->valueint > 0)
+			tpl.num_h = json_num_h->valueint;
+		if (json_num_v && json_num_v->type == cJSON_Number && json_num_v->valueint > 0)
+			tpl.num_v = json_num_v->valueint;
+		if (json_interval && json_interval->type == cJSON_Number)
+			tpl.anim_interval = json_interval->valuedouble;
+
+		parse_int_list(tpl.idx_list_up, cJSON_GetObjectItem(json_animation, "up"));
+		parse_int_list(tpl.idx_list_down, cJSON_GetObjectItem(json_animation, "down"));
+		parse_int_list(tpl.idx_list_left, cJSON_GetObjectItem(json_animation, "left"));
+		parse_int_list(tpl.idx_list_right, cJSON_GetObjectItem(json_animation, "right"));
+	}
+
+	void parse_int_list(std::vector<int> &list, cJSON *json_root)
+	{
+		if (!json_root || json_root->type != cJSON_Array)
+			return;
+
+		list.clear();
+		cJSON *json_element = nullptr;
+		cJSON_ArrayForEach(json_element, json_root)
+		{
+			if (json_element->type == cJSON_Number)
+				list.push_back(json_element->valueint);
+		}
 	}
 };
 #endif // !_CONFIG_MANAGER_H_
@@ -0,0 +1,312 @@
+#ifndef _DECODE_CACHE_H_
+#define _DECODE_CACHE_H_
+
+/**
+ * @brief デコード済みアセットのキャッシュクラス
+ *
+ * このクラスは、画像（PNG）と効果音（MP3/WAV）をデコードした結果を、元のファイルの内容のハッシュ値をキーとして
+ * ディスクに保存し、次回以降の起動ではデコードせずにファイルから直接読み込むためのクラスです。
+ * 起動時間の大部分を占める PNG の展開と MP3 のデコードを、初回の起動（またはファイルの更新後）のみに限定します。
+ *
+ * キャッシュファイルの形式（リトルエンディアン）:
+ * - 画像（<ハッシュ値>.img）: "VRDI"(4) + バージョン(u16) + 予約(u16) + ハッシュ値(u64) + 幅(u32) + 高さ(u32) + RGBA32の画素
+ * - 効果音（<ハッシュ値>.pcm）: "VRDA"(4) + バージョン(u16) + チャンネル数(u16) + ハッシュ値(u64)
+ *   + 周波数(u32) + サンプル形式(u16) + 予約(u16) + バイト数(u32) + PCMデータ（ミキサーの出力形式）
+ *
+ * 主な機能:
+ * - load_image() / load_sound() で元のファイルの内容からサーフェス・チャンクを作成（キャッシュがあればデコードしない）
+ * - read_image() / write_image() でサーフェスを画像のキャッシュ形式で読み書き（アトラスのページの保存にも使用）
+ *
+ * 注意事項:
+ * - 読み込み時にヘッダーとファイルサイズを検証し、効果音はミキサーの出力形式が異なる場合もデコードし直します
+ * - 各メソッドはワーカースレッドから並列に呼び出せます（効果音のデコード（Mix_LoadWAV_RW）のみ、排他制御により一度に1つずつ行います）
+ *   （同じ内容のファイルを同時に保存する場合に備え、一時ファイルに書き込んでから名前を変更します）
+ */
+
+#include <SDL.h>
+#include <SDL_image.h>
+#include <SDL_mixer.h>
+
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <mutex>
+#include <thread>
+#include <functional>
+#include <filesystem>
+
+class DecodeCache
+{
+public:
+	// ミキサーの出力形式（Mix_QuerySpec() の結果）
+	struct AudioSpec
+	{
+		int frequency = 0;
+		Uint16 format = 0;
+		int channels = 0;
+	};
+
+public:
+	DecodeCache(const std::string &dir_cache, const AudioSpec &spec_audio) : dir_cache(dir_cache), spec_audio(spec_audio)
+	{
+		std::error_code error;
+		std::filesystem::create_directories(dir_cache, error); // 作成できない場合は保存に失敗するだけで、デコードは行える
+	}
+	~DecodeCache() = default;
+
+	// 画像ファイルの内容からRGBA32のサーフェスを作成（キャッシュがない場合はデコードして保存）
+	SDL_Surface *load_image(const uint8_t *data, size_t size) const
+	{
+		const uint64_t hash = compute_hash(data, size);
+		const std::string path = get_path(hash, ".img");
+
+		SDL_Surface *surface = read_image(path, hash);
+		if (surface)
+			return surface;
+
+		surface = IMG_Load_RW(SDL_RWFromConstMem(data, (int)size), 1);
+		if (!surface)
+			return nullptr;
+
+		// キャッシュの画素はRGBA32に統一する
+		if (surface->format->format != SDL_PIXELFORMAT_RGBA32)
+		{
+			SDL_Surface *surface_converted = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
+			SDL_FreeSurface(surface);
+			surface = surface_converted;
+			if (!surface)
+				return nullptr;
+		}
+
+		write_image(path, surface, hash);
+		return surface;
+	}
+
+	// 効果音ファイルの内容からチャンクを作成（キャッシュがない場合はデコードして保存）
+	Mix_Chunk *load_sound(const uint8_t *data, size_t size) const
+	{
+		const uint64_t hash = compute_hash(data, size);
+		const std::string path = get_path(hash, ".pcm");
+
+		Mix_Chunk *chunk = read_sound(path, hash);
+		if (chunk)
+			return chunk;
+
+		// SDL_mixer はデコードのスレッドセーフ性を保証していないため、デコードは一度に1つずつ行う
+		{
+			static std::mutex mutex_mixer;
+			std::lock_guard<std::mutex> lock(mutex_mixer);
+			chunk = Mix_LoadWAV_RW(SDL_RWFromConstMem(data, (int)size), 1);
+		}
+		if (chunk)
+			write_sound(path, chunk, hash);
+		return chunk;
+	}
+
+	// 画像のキャッシュファイルを読み込む（形式が正しくない場合、ハッシュ値が一致しない場合はnullptr）
+	static SDL_Surface *read_image(const std::string &path, uint64_t hash)
+	{
+		std::ifstream file(path, std::ios::binary);
+		if (!file.good())
+			return nullptr;
+
+		char magic_file[4] = {0};
+		uint16_t version_file = 0, reserved = 0;
+		uint64_t hash_file = 0;
+		uint32_t width = 0, height = 0;
+		file.read(magic_file, sizeof(magic_file));
+		read_value(file, version_file);
+		read_value(file, reserved);
+		read_value(file, hash_file);
+		read_value(file, width);
+		read_value(file, height);
+		if (!file.good() || std::memcmp(magic_file, magic_image, sizeof(magic_image)) != 0 || version_file != version || hash_file != hash)
+			return nullptr;
+		if (width == 0 || height == 0 || width > max_size_image || height > max_size_image || !check_size_rest(file, (uint64_t)width * height * 4))
+			return nullptr;
+
+		// 画素をサーフェスに直接読み込む
+		SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormat(0, (int)width, (int)height, 32, SDL_PIXELFORMAT_RGBA32);
+		if (!surface)
+			return nullptr;
+
+		const size_t size_row = (size_t)width * 4;
+		for (uint32_t y = 0; y < height && file.good(); y++)
+			file.read((char *)surface->pixels + (size_t)y * surface->pitch, size_row);
+		if (!file.good())
+		{
+			SDL_FreeSurface(surface);
+			return nullptr;
+		}
+
+		return surface;
+	}
+
+	// RGBA32のサーフェスを画像のキャッシュファイルに保存
+	static bool write_image(const std::string &path, const SDL_Surface *surface, uint64_t hash)
+	{
+		if (surface->format->format != SDL_PIXELFORMAT_RGBA32)
+			return false;
+
+		return write_atomic(path, [&](std::ofstream &file)
+							{
+			file.write(magic_image, sizeof(magic_image));
+			write_value<uint16_t>(file, version);
+			write_value<uint16_t>(file, 0);
+			write_value<uint64_t>(file, hash);
+			write_value<uint32_t>(file, (uint32_t)surface->w);
+			write_value<uint32_t>(file, (uint32_t)surface->h);
+			for (int y = 0; y < surface->h; y++)
+				file.write((const char *)surface->pixels + (size_t)y * surface->pitch, (size_t)surface->w * 4); });
+	}
+
+	// 64ビットの FNV-1a
+	static uint64_t compute_hash(const uint8_t *data, size_t size)
+	{
+		uint64_t hash = 14695981039346656037ull;
+		for (size_t i = 0; i < size; i++)
+		{
+			hash ^= data[i];
+			hash *= 1099511628211ull;
+		}
+		return hash;
+	}
+
+private:
+	static constexpr char magic_image[4] = {'V', 'R', 'D', 'I'};
+	static constexpr char magic_sound[4] = {'V', 'R', 'D', 'A'};
+	static constexpr uint16_t version = 1;
+	static constexpr uint32_t max_size_image = 16384; // 壊れたファイルで巨大なサーフェスを確保しないための上限
+
+private:
+	std::string dir_cache;
+	AudioSpec spec_audio;
+
+private:
+	std::string get_path(uint64_t hash, const char *extension) const
+	{
+		char str_hash[17];
+		snprintf(str_hash, sizeof(str_hash), "%016llx", (unsigned long long)hash);
+		return dir_cache + "/" + str_hash + extension;
+	}
+
+	// 効果音のキャッシュファイルを読み込み、Mix_LoadWAV と同じく解放可能なチャンクを作成
+	Mix_Chunk *read_sound(const std::string &path, uint64_t hash) const
+	{
+		std::ifstream file(path, std::ios::binary);
+		if (!file.good())
+			return nullptr;
+
+		char magic_file[4] = {0};
+		uint16_t version_file = 0, channels = 0, format = 0, reserved = 0;
+		uint64_t hash_file = 0;
+		uint32_t frequency = 0, length = 0;
+		file.read(magic_file, sizeof(magic_file));
+		read_value(file, version_file);
+		read_value(file, channels);
+		read_value(file, hash_file);
+		read_value(file, frequency);
+		read_value(file, format);
+		read_value(file, reserved);
+		read_value(file, length);
+		if (!file.good() || std::memcmp(magic_file, magic_sound, sizeof(magic_sound)) != 0 || version_file != version || hash_file != hash)
+			return nullptr;
+
+		// ミキサーの出力形式が変わった場合は無効
+		if ((int)frequency != spec_audio.frequency || format != spec_audio.format || (int)channels != spec_audio.channels)
+			return nullptr;
+		if (length == 0 || !check_size_rest(file, length))
+			return nullptr;
+
+		Uint8 *buffer = (Uint8 *)SDL_malloc(length);
+		if (!buffer)
+			return nullptr;
+		if (!file.read((char *)buffer, length))
+		{
+			SDL_free(buffer);
+			return nullptr;
+		}
+
+		// Mix_FreeChunk() で allocated が1の場合は abuf も解放される
+		Mix_Chunk *chunk = (Mix_Chunk *)SDL_malloc(sizeof(Mix_Chunk));
+		if (!chunk)
+		{
+			SDL_free(buffer);
+			return nullptr;
+		}
+		chunk->allocated = 1;
+		chunk->abuf = buffer;
+		chunk->alen = length;
+		chunk->volume = MIX_MAX_VOLUME;
+		return chunk;
+	}
+
+	bool write_sound(const std::string &path, const Mix_Chunk *chunk, uint64_t hash) const
+	{
+		return write_atomic(path, [&](std::ofstream &file)
+							{
+			file.write(magic_sound, sizeof(magic_sound));
+			write_value<uint16_t>(file, version);
+			write_value<uint16_t>(file, (uint16_t)spec_audio.channels);
+			write_value<uint64_t>(file, hash);
+			write_value<uint32_t>(file, (uint32_t)spec_audio.frequency);
+			write_value<uint16_t>(file, spec_audio.format);
+			write_value<uint16_t>(file, 0);
+			write_value<uint32_t>(file, chunk->alen);
+			file.write((const char *)chunk->abuf, chunk->alen); });
+	}
+
+	// 一時ファイルに書き込んでから名前を変更し、書きかけのファイルが読み込まれないようにする
+	static bool write_atomic(const std::string &path, const std::function<void(std::ofstream &file)> &on_write)
+	{
+		std::stringstream str_stream;
+		str_stream << path << ".tmp" << std::hash<std::thread::id>()(std::this_thread::get_id());
+		const std::string path_temp = str_stream.str();
+
+		bool is_written = false;
+		{
+			std::ofstream file(path_temp, std::ios::binary | std::ios::trunc);
+			if (file.good())
+			{
+				on_write(file);
+				is_written = file.good();
+			}
+		}
+
+		std::error_code error;
+		if (is_written)
+			std::filesystem::rename(path_temp, path, error);
+		if (!is_written || error)
+			std::filesystem::remove(path_temp, error);
+
+		return is_written && !error;
+	}
+
+	// ファイルの残りのサイズが期待どおりかどうか（途中で切れたファイルを読み込まない）
+	static bool check_size_rest(std::ifstream &file, uint64_t size_expected)
+	{
+		const std::streampos pos = file.tellg();
+		file.seekg(0, std::ios::end);
+		const std::streampos pos_end = file.tellg();
+		file.seekg(pos);
+		return file.good() && (uint64_t)(pos_end - pos) == size_expected;
+	}
+
+	template <typename T>
+	static void write_value(std::ofstream &file, T val)
+	{
+		file.write(reinterpret_cast<const char *>(&val), sizeof(T));
+	}
+
+	template <typename T>
+	static bool read_value(std::ifstream &file, T &val)
+	{
+		return (bool)file.read(reinterpret_cast<char *>(&val), sizeof(T));
+	}
+};
+
+#endif // !_DECODE_CACHE_H_
@@ -14,28 +14,36 @@
  * - コインドロップの処理
  *
  * 使用方法:
- * - Enemy オブジェクトを生成し、初期化する
- * - on_update() メソッドを毎フレーム呼び出して敵の状態を更新
- * - on_render() メソッドを使用して敵をレンダリング
+ * - Enemy オブジェクトを生成（またはオブジェクトプールから取り出し）、
+ *   reset() で EnemyArchetype（設定ファイルの敵テンプレートから作成）の属性とアニメーションを設定して、
+ *   bind_store() で EnemyStore に登録する
+ * - on_update_animation() を毎フレーム呼び出して敵の状態を更新
+ *   （移動は EnemyStore::update_movement() ですべての敵をまとめて処理、タイマーは TimerManager が処理）
+ * - 削除時は on_remove() を呼び出してタイマーを停止する
+ * - on_render() と on_render_hp_bar() メソッドを使用して敵とHPバーをスプライトバッチに追加
  * - take_damage() メソッドでダメージを与える
  * - set_skill() メソッドでスキルを設定
  *
  * 注意事項:
  * - 敵の初期化時に適切な経路とスキルを設定することが重要
- * - メモリリークを防ぐため、不要になった敵オブジェクトの適切な削除が必要
+ * - 敵オブジェクトは EnemyManager のオブジェクトプールで再利用されるため、削除後のポインタを保持しないこと
+ * - 位置、HP、速度、経路などのデータは EnemyStore に格納されるため、登録前に参照しないこと
  * - スキルのコールバック関数は適切に設定し、nullptrチェックを行うこと
  */
 
-#include "timer.h"
+#include "timer_manager.h"
 #include "vector2.h"
 #include "animation.h"
 #include "route.h"
 #include "config_manager.h"
 #include "coin_manager.h"
+#include "random_manager.h"
+#include "enemy_store.h"
+#include "enemy_archetype.h"
 
 #include <functional>
-#include <random>
-	class Enemy
+
+class Enemy
 {
 public:
 	typedef std::function<void(Enemy *enemy)> SkillCallback; // スキル発動のコールバック関数タイプを定義
@@ -54,70 +62,100 @@ public:
 
 		timer_restore_speed.set_one_shot(true); // 速度回復タイマー、一回のみ発動
 		timer_restore_speed.set_on_timeout([&]()
-										   { speed = max_speed; }); // 最大速度に回復
+										   { store->set_speed(handle, max_speed); }); // 最大速度に回復
 	}
 	~Enemy() = default;
 
-	/*フレームごとの更新関数、移動、アニメーション、タイマーの更新を処理*/
-	void on_update(double delta)
+	// アーキタイプから属性をコピーしてアニメーションのクリップを参照し、生成直後の状態に戻す
+	// （オブジェクトプールから取り出すたびに呼び出す）
+	void reset(const EnemyArchetype &archetype)
 	{
-		timer_skill.on_update(delta);		  // スキルタイマーを更新
-		timer_sketch.on_update(delta);		  // ヒットアニメーションタイマーを更新
-		timer_restore_speed.on_update(delta); // 速度回復タイマーを更新
-
-		/*速度とフレーム間隔に基づいて移動距離を計算*/
-		Vector2 move_distance = velocity * delta;			  // 現在のフレームの最大移動距離
-		Vector2 target_distance = position_target - position; // 現在のフレームから目標点までの距離
+		const ConfigManager::EnemyTemplate &tpl = *archetype.tpl;
+		max_hp = tpl.hp;
+		max_speed = tpl.speed;
+		damage = tpl.damage;
+		reward_ratio = tpl.reward_ratio;
+		recover_interval = tpl.recover_interval;
+		recover_range = tpl.recover_range;
+		recover_intensity = tpl.recover_intensity;
+
+		size.x = tpl.size[0], size.y = tpl.size[1];
+
+		this->archetype = &archetype;
+		anim.play(nullptr); // クリップは最初の更新時に向きに応じて選択
+
+		timer_skill.set_wait_time(recover_interval); // スキルの発動間隔を設定
+		timer_skill.restart();
+		timer_sketch.stop();
+		timer_restore_speed.stop();
+
+		is_show_sketch = false;
+		store = nullptr;
+		handle = -1;
+		idx_grid_cell = -1;
+	}
 
-		// 目標点に近づいたかどうかを判断
-		if (target_distance.approx_zero())
-		{
-			idx_target++;										  // 目標点のインデックスを更新
-			refresh_position_target();							  // 次の目標位置を更新
-			direction = (position_target - position).normalize(); // 移動方向を更新
-		}
+	// 削除時にタイマーを停止（オブジェクトプールに返却された敵のコールバックが呼び出されないようにする）
+	void on_remove()
+	{
+		timer_skill.stop();
+		timer_sketch.stop();
+		timer_restore_speed.stop();
+	}
 
-		position += move_distance < target_distance ? move_distance : target_distance; // 実際の移動距離
-		// 速度を計算、方向 * 速度 * 単一グリッドの距離
-		velocity.x = direction.x * speed * SIZE_TILE;
-		velocity.y = direction.y * speed * SIZE_TILE;
+	/*フレームごとの更新関数、アニメーションの選択と更新を処理（移動の後に呼び出す）*/
+	void on_update_animation(double delta)
+	{
+		const Vector2 &velocity = store->get_velocity(handle);
 
-		/*速度と状態に基づいて現在のアニメーションを選択*/
+		/*速度と状態に基づいて現在のアニメーションのクリップを選択（経過時間は維持）*/
 		bool is_show_x_amin = abs(velocity.x) >= abs(velocity.y);
 
 		if (is_show_sketch)
 		{
 			if (is_show_x_amin)
-				anim_current = velocity.x > 0 ? &anim_right_sketch : &anim_left_sketch;
+				anim.set_clip(velocity.x > 0 ? &archetype->clip_right_sketch : &archetype->clip_left_sketch);
 			else
-				anim_current = velocity.y > 0 ? &anim_down_sketch : &anim_up_sketch;
+				anim.set_clip(velocity.y > 0 ? &archetype->clip_down_sketch : &archetype->clip_up_sketch);
 		}
 		else
 		{
 			if (is_show_x_amin)
-				anim_current = velocity.x > 0 ? &anim_right : &anim_left;
+				anim.set_clip(velocity.x > 0 ? &archetype->clip_right : &archetype->clip_left);
 			else
-				anim_current = velocity.y > 0 ? &anim_down : &anim_up;
+				anim.set_clip(velocity.y > 0 ? &archetype->clip_down : &archetype->clip_up);
 		}
 
-		anim_current->on_update(delta);
+		anim.on_update(delta);
 	}
 
+	// 敵キャラクターをスプライトバッチに追加
 	void on_render(SDL_Renderer *renderer)
+	{
+		static thread_local SDL_Point point;
+
+		const Vector2 &position = store->get_position(handle);
+
+		// 敵キャラクターの描画位置を計算
+		point.x = (int)(position.x - size.x / 2);
+		point.y = (int)(position.y - size.y / 2);
+		// 現在のアニメーションフレームを描画
+		anim.on_render(point);
+	}
+
+	// HPバーをスプライトバッチに追加（すべての敵のスプライトより上に描画するため、別の層として呼び出す）
+	void on_render_hp_bar(SDL_Renderer *renderer)
 	{
 		// 描画に必要な静的変数を定義
-		static SDL_Rect rect;
-		static SDL_Point point;
+		SpriteBatchManager *sprite_batch = SpriteBatchManager::instance();
+		static thread_local SDL_Rect rect;
 		static const Vector2 size_hp_bar = {40, 8};					 // HPバーのサイズ
 		static const int offset_y = 2;								 // HPバーのY軸オフセット
 		static const SDL_Color color_border = {116, 185, 124, 255};	 // HPバーの枠線の色（緑）
 		static const SDL_Color color_content = {226, 255, 194, 255}; // HPバーの中身の色（淡緑）
 
-		// 敵キャラクターの描画位置を計算
-		point.x = (int)(position.x - size.x / 2);
-		point.y = (int)(position.y - size.y / 2);
-		// 現在のアニメーションフレームを描画
-		anim_current->on_render(renderer, point);
+		const Vector2 &position = store->get_position(handle);
+		const double hp = store->get_hp(handle);
 
 		// HPバーを描画
 		if (hp < max_hp)
@@ -126,12 +164,10 @@ public:
 			rect.y = (int)(position.y - size.y / 2 - size_hp_bar.y - offset_y);
 			rect.w = (int)(size_hp_bar.x * (hp / max_hp));
 			rect.h = (int)(size_hp_bar.y);
-			SDL_SetRenderDrawColor(renderer, color_content.r, color_content.g, color_content.b, color_content.a);
-			SDL_RenderFillRect(renderer, &rect);
+			sprite_batch->fill_rect(rect, color_content);
 
 			rect.w = (int)size_hp_bar.x;
-			SDL_SetRenderDrawColor(renderer, color_border.r, color_border.g, color_border.b, color_border.a);
-			SDL_RenderDrawRect(renderer, &rect);
+			sprite_batch->draw_rect(rect, color_border);
 		}
 	}
 
@@ -140,54 +176,89 @@ public:
 		this->on_skill_released = on_skill_released;
 	}
 
+	// スキル発動のコールバック関数が設定済みかどうか（プールから再利用する際に設定し直さないため）
+	bool check_on_skill_released() const
+	{
+		return (bool)on_skill_released;
+	}
+
+	// EnemyStore に登録し、データを初期化（HPと速度は最大値から開始）
+	void bind_store(EnemyStore *store)
+	{
+		this->store = store;
+		handle = store->add(this, size, max_hp, max_speed);
+	}
+
+	// EnemyStore 上の配列が詰められた場合にハンドルを付け直す
+	void set_handle(EnemyStore::Handle handle)
+	{
+		this->handle = handle;
+	}
+
+	EnemyStore::Handle get_handle() const
+	{
+		return handle;
+	}
+
 	void increase_hp(double val)
 	{
-		hp += val;
-		if (hp > max_hp)
-		{
-			hp = max_hp;
-		}
+		store->increase_hp(handle, val);
 	}
 
 	void decrease_hp(double val)
 	{
-		hp -= val;
-		if (hp <= 0)
-		{
-			hp = 0;
-			is_valid = false;
-		}
+		store->decrease_hp(handle, val);
 		is_show_sketch = true;
 		timer_sketch.restart();
 	}
 
 	void slow_down()
 	{
-		speed = max_speed - 0.5;
+		store->set_speed(handle, max_speed - 0.5);
 		timer_restore_speed.set_wait_time(1);
 		timer_restore_speed.restart();
 	}
 
 	void set_position(const Vector2 &position)
 	{
-		this->position = position;
+		store->set_position(handle, position);
 	}
 
 	void set_route(const Route *route)
 	{
-		this->route = route;
-
-		refresh_position_target();
+		store->set_route(handle, route);
 	}
 
 	void make_invalid()
 	{
-		is_valid = false;
+		store->make_invalid(handle);
+	}
+
+	// 生成順の番号（空間グリッドの検索結果の並べ替えに使用）
+	void set_id_spawn(Uint64 id)
+	{
+		id_spawn = id;
+	}
+
+	Uint64 get_id_spawn() const
+	{
+		return id_spawn;
+	}
+
+	// 空間グリッド上のセル番号（未登録の場合は-1）
+	void set_idx_grid_cell(int idx)
+	{
+		idx_grid_cell = idx;
+	}
+
+	int get_idx_grid_cell() const
+	{
+		return idx_grid_cell;
 	}
 
 	double get_hp() const
 	{
-		return hp;
+		return store->get_hp(handle);
 	}
 
 	const Vector2 &get_size() const
@@ -197,12 +268,12 @@ public:
 
 	const Vector2 &get_position() const
 	{
-		return position;
+		return store->get_position(handle);
 	}
 
 	const Vector2 &get_velocity() const
 	{
-		return velocity;
+		return store->get_velocity(handle);
 	}
 
 	double get_damage() const
@@ -227,54 +298,39 @@ public:
 
 	bool can_remove() const
 	{
-		return !is_valid;
+		return !store->check_valid(handle);
 	}
 
 	// 敵の進行度（大きいほど防御点に近い）（防御塔の敵探知に使用）
 	double get_route_process() const
 	{
-		if (route->get_idx_list().size() == 1)
-		{
-			return 1;
-		}
-		return (double)idx_target / (route->get_idx_list().size() - 1);
+		return store->get_route_process(handle);
 	}
 
 	// 確率に基づいてコインを生成
 	void try_spawn_coin_prop(const Vector2 &position, double ratio)
 	{
-		static CoinManager *instance = CoinManager::instance();
+		CoinManager *instance = CoinManager::instance();
+		RandomManager *random_manager = RandomManager::instance();
 
-		std::random_device rd;
-		std::mt19937 generator(rd());
-		std::uniform_real_distribution<double> distribution(0.0, 1.0); // (0, 1)の乱数を生成
-
-		if (distribution(generator) <= ratio)
+		// ゲームプレイ用の乱数列から[0, 1)の乱数を取得
+		if (random_manager->gameplay_real() <= ratio)
 		{
 			instance->spawn_coin_prop(position);
 		}
 	}
 
-protected:
+private:
 	// 敵のサイズ
 	Vector2 size;
 	// スキル発動タイマー
-	Timer timer_skill;
-
-	// 四方向のアニメーション＆ヒットアニメーション
-	Animation anim_up;
-	Animation anim_down;
-	Animation anim_left;
-	Animation anim_right;
-	Animation anim_up_sketch;
-	Animation anim_down_sketch;
-	Animation anim_left_sketch;
-	Animation anim_right_sketch;
-
-	// 敵の属性
-	double hp = 0; // 現在のHP
+	WorldTimer timer_skill;
+
+	// 敵の種類のアーキタイプ（四方向のアニメーション＆ヒットアニメーションのクリップを保持）
+	const EnemyArchetype *archetype = nullptr;
+
+	// 敵の属性（現在のHPと速度は EnemyStore に格納）
 	double max_hp = 0;
-	double speed = 0;
 	double max_speed = 0;
 	double damage = 0;
 	double reward_ratio = 0;
@@ -283,46 +339,28 @@ protected:
 	double recover_intensity = 0;
 
 private:
-	Vector2 position;  // 位置
-	Vector2 velocity;  // 速度
-	Vector2 direction; // 方向
-
-	// 敵が倒されたかどうか
-	bool is_valid = true;
+	// 位置、速度、HP、経路などを格納する EnemyStore とそのハンドル
+	EnemyStore *store = nullptr;
+	EnemyStore::Handle handle = -1;
 
 	// ヒットアニメーションの再生時間
-	Timer timer_sketch;
+	WorldTimer timer_sketch;
 
 	// ヒットアニメーションを再生するかどうか
 	bool is_show_sketch = false;
 
-	// 現在のアニメーション
-	Animation *anim_current = nullptr;
+	// アニメーションの再生位置（クリップは向きとヒット状態に応じて切り替え）
+	Animation anim;
 
 	// スキル発動のコールバック関数
 	SkillCallback on_skill_released;
 
 	// 速度回復の時間を保存（減速効果がある可能性）
-	Timer timer_restore_speed;
-
-	// 経路探索関連
-	const Route *route = nullptr; // 経路
-	int idx_target = 0;			  // 最終目標
-	Vector2 position_target;	  // 移動の目標位置(ワールド座標)
-
-private:
-	void refresh_position_target()
-	{
-		const Route::IdxList &idx_list = route->get_idx_list();
-		if (idx_target < idx_list.size())
-		{
-			const SDL_Point &point = idx_list[idx_target];
-			static const SDL_Rect &rect_tile_map = ConfigManager::instance()->rect_tile_map;
+	WorldTimer timer_restore_speed;
 
-			position_target.x = rect_tile_map.x + point.x * SIZE_TILE + SIZE_TILE / 2;
-			position_target.y = rect_tile_map.y + point.y * SIZE_TILE + SIZE_TILE / 2;
-		}
-	}
+	// 空間グリッド関連
+	Uint64 id_spawn = 0;	// 生成順の番号
+	int idx_grid_cell = -1; // 登録されているセル番号
 };
 
 #endif // !_ENEMY_H_
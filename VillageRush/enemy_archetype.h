@@ -0,0 +1,62 @@
+#ifndef _ENEMY_ARCHETYPE_H_
+#define _ENEMY_ARCHETYPE_H_
+
+/**
+ * @brief 敵のアーキタイプ構造体
+ *
+ * この構造体は、敵の種類ごとに一度だけ作成されるデータ（属性テンプレートとアニメーションクリップ）を保持します。
+ * 敵の生成時はアーキタイプを参照するだけで済み、種類ごとのアニメーションの設定やテクスチャの問い合わせは行いません。
+ *
+ * 属性はゲーム設定の EnemyTemplate を参照するため、set_config_value() による変更は次に生成する敵から反映されます。
+ */
+
+#include "animation.h"
+#include "config_manager.h"
+#include "resources_manager.h"
+
+struct EnemyArchetype
+{
+	const ConfigManager::EnemyTemplate *tpl = nullptr; // 属性テンプレート
+
+	// 四方向のアニメーション＆ヒットアニメーションのクリップ（同じ種類のすべての敵で共有）
+	AnimationClip clip_up;
+	AnimationClip clip_down;
+	AnimationClip clip_left;
+	AnimationClip clip_right;
+	AnimationClip clip_up_sketch;
+	AnimationClip clip_down_sketch;
+	AnimationClip clip_left_sketch;
+	AnimationClip clip_right_sketch;
+
+	// テンプレートのアニメーション設定からクリップを作成（テクスチャアトラス上の矩形を使用、ヘッドレスモードではテクスチャはnullptr）
+	void load(const ConfigManager::EnemyTemplate &tpl)
+	{
+		const ResourcesManager *resources_manager = ResourcesManager::instance();
+		const TextureRegion region = resources_manager->find_region(tpl.path_texture);
+		const TextureRegion region_sketch = resources_manager->find_region(tpl.path_texture_sketch);
+
+		this->tpl = &tpl;
+
+		load_clip(clip_up, region, tpl, tpl.idx_list_up);
+		load_clip(clip_down, region, tpl, tpl.idx_list_down);
+		load_clip(clip_left, region, tpl, tpl.idx_list_left);
+		load_clip(clip_right, region, tpl, tpl.idx_list_right);
+		load_clip(clip_up_sketch, region_sketch, tpl, tpl.idx_list_up);
+		load_clip(clip_down_sketch, region_sketch, tpl, tpl.idx_list_down);
+		load_clip(clip_left_sketch, region_sketch, tpl, tpl.idx_list_left);
+		load_clip(clip_right_sketch, region_sketch, tpl, tpl.idx_list_right);
+	}
+
+private:
+	static void load_clip(AnimationClip &clip, const TextureRegion &region, const ConfigManager::EnemyTemplate &tpl, const std::vector<int> &idx_list)
+	{
+		// フレームが指定されていない場合は先頭のフレームのみを使用
+		static const std::vector<int> idx_list_default = {0};
+
+		clip.set_loop(true);
+		clip.set_interval(tpl.anim_interval);
+		clip.set_frame_data(region, tpl.num_h, tpl.num_v, idx_list.empty() ? idx_list_default : idx_list);
+	}
+};
+
+#endif // !_ENEMY_ARCHETYPE_H_
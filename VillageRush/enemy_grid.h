@@ -0,0 +1,183 @@
+#ifndef _ENEMY_GRID_H_
+#define _ENEMY_GRID_H_
+
+/**
+ * @brief 敵の空間グリッドクラス
+ *
+ * このクラスは、タイルマップを1タイル（SIZE_TILE）単位のセルに分割し、各セルにいる敵を保持します。
+ * 範囲内の敵の検索を、すべての敵ではなく範囲に重なるセルの敵だけで行うために使用します。
+ *
+ * 主な機能:
+ * - 敵の登録と削除、移動に応じたセルの更新（セルが変わった場合のみ）
+ * - 円（中心と半径）の範囲内にいる敵の検索
+ * - 矩形の範囲内にいる敵の検索
+ * - 座標からセル番号への変換（弾丸など、敵以外のオブジェクトを同じセルに分類する場合に使用）
+ *
+ * 注意事項:
+ * - マップ外の敵は最も近い端のセルに登録されるため、検索結果から漏れることはありません
+ * - 検索結果は敵の生成順に並べるため、敵リストを順番に調べた場合と同じ順序になります
+ */
+
+#include "enemy.h"
+#include "vector2.h"
+
+#include <SDL.h>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+class EnemyGrid
+{
+public:
+	typedef std::vector<Enemy *> EnemyList;
+
+public:
+	EnemyGrid() = default;
+	~EnemyGrid() = default;
+
+	// グリッドの範囲（タイルマップの矩形）を設定し、すべてのセルを空にする
+	void init(const SDL_Rect &rect_area)
+	{
+		this->rect_area = rect_area;
+		num_col = std::max(1, (rect_area.w + SIZE_TILE - 1) / SIZE_TILE);
+		num_row = std::max(1, (rect_area.h + SIZE_TILE - 1) / SIZE_TILE);
+		cell_list.assign((size_t)num_col * num_row, EnemyList());
+	}
+
+	bool check_initialized() const
+	{
+		return !cell_list.empty();
+	}
+
+	int get_num_col() const
+	{
+		return num_col;
+	}
+
+	int get_num_row() const
+	{
+		return num_row;
+	}
+
+	// X座標に対応する列番号（範囲外の場合は端の列）
+	int get_idx_col(double x) const
+	{
+		const int idx = (int)std::floor((x - rect_area.x) / SIZE_TILE);
+		return std::min(std::max(idx, 0), num_col - 1);
+	}
+
+	// Y座標に対応する行番号（範囲外の場合は端の行）
+	int get_idx_row(double y) const
+	{
+		const int idx = (int)std::floor((y - rect_area.y) / SIZE_TILE);
+		return std::min(std::max(idx, 0), num_row - 1);
+	}
+
+	int get_idx_cell(const Vector2 &position) const
+	{
+		return get_idx_row(position.y) * num_col + get_idx_col(position.x);
+	}
+
+	// 敵を現在位置のセルに登録
+	void insert(Enemy *enemy)
+	{
+		const int idx_cell = get_idx_cell(enemy->get_position());
+		cell_list[idx_cell].push_back(enemy);
+		enemy->set_idx_grid_cell(idx_cell);
+	}
+
+	// 敵を登録されているセルから削除
+	void remove(Enemy *enemy)
+	{
+		const int idx_cell = enemy->get_idx_grid_cell();
+		if (idx_cell < 0)
+			return;
+
+		// セル内の順序は検索時に並べ直すため、末尾と入れ替えて削除
+		EnemyList &cell = cell_list[idx_cell];
+		const auto itor = std::find(cell.begin(), cell.end(), enemy);
+		if (itor != cell.end())
+		{
+			*itor = cell.back();
+			cell.pop_back();
+		}
+		enemy->set_idx_grid_cell(-1);
+	}
+
+	// 敵の移動後に呼び出し、セルが変わった場合のみ登録し直す
+	void on_move(Enemy *enemy)
+	{
+		if (get_idx_cell(enemy->get_position()) == enemy->get_idx_grid_cell())
+			return;
+
+		remove(enemy);
+		insert(enemy);
+	}
+
+	// centerからの距離がradius以下の敵を検索し、生成順にresultに格納
+	void query_radius(const Vector2 &center, double radius, EnemyList &result) const
+	{
+		result.clear();
+		if (!check_initialized() || radius < 0)
+			return;
+
+		const int idx_x_min = get_idx_col(center.x - radius), idx_x_max = get_idx_col(center.x + radius);
+		const int idx_y_min = get_idx_row(center.y - radius), idx_y_max = get_idx_row(center.y + radius);
+		for (int y = idx_y_min; y <= idx_y_max; y++)
+		{
+			for (int x = idx_x_min; x <= idx_x_max; x++)
+			{
+				for (Enemy *enemy : cell_list[y * num_col + x])
+				{
+					if ((enemy->get_position() - center).length() <= radius)
+						result.push_back(enemy);
+				}
+			}
+		}
+
+		sort_by_spawn_order(result);
+	}
+
+	// 矩形の範囲内（境界を含む）にいる敵を検索し、生成順にresultに格納
+	void query_rect(const SDL_Rect &rect, EnemyList &result) const
+	{
+		result.clear();
+		if (!check_initialized())
+			return;
+
+		const int idx_x_min = get_idx_col(rect.x), idx_x_max = get_idx_col(rect.x + rect.w);
+		const int idx_y_min = get_idx_row(rect.y), idx_y_max = get_idx_row(rect.y + rect.h);
+		for (int y = idx_y_min; y <= idx_y_max; y++)
+		{
+			for (int x = idx_x_min; x <= idx_x_max; x++)
+			{
+				for (Enemy *enemy : cell_list[y * num_col + x])
+				{
+					const Vector2 &position = enemy->get_position();
+					if (position.x >= rect.x && position.x <= rect.x + rect.w && position.y >= rect.y && position.y <= rect.y + rect.h)
+						result.push_back(enemy);
+				}
+			}
+		}
+
+		sort_by_spawn_order(result);
+	}
+
+private:
+	SDL_Rect rect_area = {0};
+	int num_col = 0;
+	int num_row = 0;
+	std::vector<EnemyList> cell_list; // セルごとの敵リスト（行優先）
+
+private:
+
+	// 検索結果を生成順に並べ替え（乱数の消費順などを敵リストの順序と一致させるため）
+	static void sort_by_spawn_order(EnemyList &result)
+	{
+		std::sort(result.begin(), result.end(),
+				  [](const Enemy *enemy_a, const Enemy *enemy_b)
+				  { return enemy_a->get_id_spawn() < enemy_b->get_id_spawn(); });
+	}
+};
+
+#endif // !_ENEMY_GRID_H_
@@ -7,32 +7,36 @@
  * このクラスは、ゲーム内のすべての敵オブジェクトを管理します。
  *
  * 主な機能:
- * - 敵の生成、更新、削除
+ * - 敵の生成、更新、削除（毎刻み参照するデータは EnemyStore に項目ごとの配列で格納、敵オブジェクトはオブジェクトプールで再利用）
  * - 敵と本拠地の衝突検出
- * - 敵と弾丸の衝突検出
+ * - 敵と弾丸の衝突検出（同じセルにいる組み合わせのみを判定）
  * - 敵のレンダリング
+ * - 空間グリッドによる範囲内の敵の検索
  *
  * 使用方法:
  * - EnemyManager::instance()->spawn_enemy() で新しい敵を生成
  * - EnemyManager::instance()->on_update() で敵の状態を更新
  * - EnemyManager::instance()->on_render() で敵をレンダリング
+ * - EnemyManager::instance()->get_enemy_grid().query_radius() で範囲内の敵を検索
  */
 
 #include "manager.h"
 #include "enemy.h"
+#include "enemy_archetype.h"
+#include "enemy_grid.h"
+#include "enemy_store.h"
+#include "object_pool.h"
 #include "map.h"
 #include "config_manager.h"
 #include "home_manager.h"
-#include "slim_enemy.h"
-#include "king_slim_enemy.h"
-#include "skeleton_enemy.h"
-#include "goblin_enemy.h"
-#include "goblin_priest_enemy.h"
 #include "bullet_manager.h"
 #include "coin_manager.h"
+#include "profile_manager.h"
+#include "sprite_batch_manager.h"
 
 #include <vector>
 #include <SDL.h>
+#include <algorithm>
 
 /*敵の管理クラス、ゲーム内のすべての敵オブジェクトを管理する*/
 class EnemyManager : public Manager<EnemyManager>
@@ -41,39 +45,60 @@ class EnemyManager : public Manager<EnemyManager>
 
 public:
 	// すべての敵のポインタを格納する敵リストの型を定義
-	typedef std::vector<Enemy *> EnemyList;
+	typedef EnemyStore::EnemyList EnemyList;
 
 public:
 	// 毎フレーム、すべての敵の状態を更新する
 	void on_update(double delta)
 	{
+		PROFILE_ZONE("EnemyManager::on_update");
+
+		const EnemyList &enemy_list = enemy_store.get_enemy_list();
+
+		enemy_store.update_movement(delta); // すべての敵をまとめて移動
+
 		for (Enemy *enemy : enemy_list)
-			enemy->on_update(delta); // 各敵の状態を更新
+		{
+			enemy_grid.on_move(enemy);			// 移動によってセルが変わった場合はグリッドを更新
+			enemy->on_update_animation(delta); // 各敵のアニメーションを更新
+		}
 
 		process_home_collision();	// 敵と本拠地の衝突を処理
 		process_bullet_collision(); // 敵と弾丸の衝突を処理
 
 		remove_invalid_enemy(); // 無効な敵を削除
+
+		PROFILE_COUNTER("EnemyManager::num_pool_chunk_alloc", enemy_pool.get_num_chunk_alloc());
+		PROFILE_COUNTER("EnemyManager::num_pooled", enemy_pool.get_num_object());
 	}
 
 	// すべての敵をレンダリングする
 	void on_render(SDL_Renderer *renderer)
 	{
-		for (Enemy *enemy : enemy_list)
-		{
+		PROFILE_ZONE("EnemyManager::on_render");
+
+		SpriteBatchManager *sprite_batch = SpriteBatchManager::instance();
+
+		// 敵のスプライトを種類（テクスチャ）ごとにまとめて描画し、その上にHPバーをまとめて描画
+		for (Enemy *enemy : enemy_store.get_enemy_list())
 			enemy->on_render(renderer);
-		}
+		sprite_batch->flush(renderer);
+
+		for (Enemy *enemy : enemy_store.get_enemy_list())
+			enemy->on_render_hp_bar(renderer);
+		sprite_batch->flush(renderer);
 	}
 
-	void spawn_enemy(EnemyType type, int idx_spawn_point)
+	// enemy_type は ConfigManager::enemy_template_list のインデックス
+	void spawn_enemy(int enemy_type, int idx_spawn_point)
 	{
 		// 敵の生成位置を保存するための変数
-		static Vector2 position;
+		static thread_local Vector2 position;
 		// 敵の生成位置を決定するためのタイルマップの矩形領域を取得
-		static const SDL_Rect &rect_tile_map = ConfigManager::instance()->rect_tile_map;
+		const SDL_Rect &rect_tile_map = ConfigManager::instance()->rect_tile_map;
 
 		// スポーンポイントに対応するルートを検索するためのスポーナールートプールを取得
-		static const Map::SpawnerRoutePool &spawner_route_pool = ConfigManager::instance()->map.get_spawner_route_pool();
+		const Map::SpawnerRoutePool &spawner_route_pool = ConfigManager::instance()->map.get_spawner_route_pool();
 
 		// 与えられたスポーンポイントのインデックスに対応するルートを検索
 		const auto &itor = spawner_route_pool.find(idx_spawn_point);
@@ -81,54 +106,32 @@ public:
 		if (itor == spawner_route_pool.end())
 			return;
 
-		// 生成された敵のインスタンスを保持するためのポインタ
-		Enemy *enemy = nullptr;
-
-		// 与えられた敵タイプに応じて対応する敵インスタンスを生成
-		switch (type)
-		{
-		case EnemyType::Slim:
-			enemy = new SlimEnemy();
-			break;
-		case EnemyType::KingSlim:
-			enemy = new KingSlimeEnemy();
-			break;
-		case EnemyType::Skeleton:
-			enemy = new SkeletonEnemy();
-			break;
-		case EnemyType::Goblin:
-			enemy = new GoblinEnemy();
-			break;
-		case EnemyType::GoblinPriest:
-			enemy = new GoblinPriestEnemy();
-			break;
-		default:
-			enemy = new SlimEnemy();
-			break;
-		}
-
-		// 生成された敵のスキル発動時のコールバック関数を設定
-		enemy->set_on_skill_released(
-			[&](Enemy *enemy_src)
-			{
-				// スキルの回復半径を取得
-				double recover_radius = enemy_src->get_recover_radius();
-				if (recover_radius < 0)
-					return;
+		// 敵の種類が無効な場合は即座に戻る
+		if (enemy_type < 0 || enemy_type >= (int)enemy_archetype_list.size())
+			return;
 
-				// 源敵の位置を取得
-				const Vector2 pos_src = enemy_src->get_position();
+		// オブジェクトプールから敵インスタンスを取り出し、アーキタイプの属性とアニメーションを設定
+		Enemy *enemy = enemy_pool.acquire();
+		enemy->reset(enemy_archetype_list[enemy_type]);
 
-				// すべての敵をループし、回復半径内にいるかどうかを判断
-				for (Enemy *enemy_dst : enemy_list)
+		// スキル発動時のコールバック関数を設定（プールの敵インスタンスごとに初回のみ）
+		if (!enemy->check_on_skill_released())
+		{
+			enemy->set_on_skill_released(
+				[&](Enemy *enemy_src)
 				{
-					const Vector2 &pos_dst = enemy_dst->get_position();
-					double distance = (pos_dst - pos_src).length();
-					// 目標敵が回復範囲内にいる場合、そのHPを増加させる
-					if (distance <= recover_radius)
+					// スキルの回復半径を取得
+					double recover_radius = enemy_src->get_recover_radius();
+					if (recover_radius < 0)
+						return;
+
+					// 回復半径内にいる敵をグリッドから検索し、そのHPを増加させる
+					static thread_local EnemyList enemy_in_range_list;
+					enemy_grid.query_radius(enemy_src->get_position(), recover_radius, enemy_in_range_list);
+					for (Enemy *enemy_dst : enemy_in_range_list)
 						enemy_dst->increase_hp(enemy_src->get_recover_intensity());
-				}
-			});
+				});
+		}
 
 		// スポーンポイントに対応するルートのインデックスリストを取得
 		const Route::IdxList &idx_list = itor->second.get_idx_list();
@@ -137,71 +140,104 @@ public:
 		position.x = rect_tile_map.x + idx_list[0].x * SIZE_TILE + SIZE_TILE / 2;
 		position.y = rect_tile_map.y + idx_list[0].y * SIZE_TILE + SIZE_TILE / 2;
 
-		// 敵の初期位置を設定
+		// 敵を EnemyStore に登録し、初期位置を設定
+		enemy->bind_store(&enemy_store);
 		enemy->set_position(position);
 
 		// 敵に移動ルートを割り当てる
 		enemy->set_route(&itor->second);
 
-		// 敵をグローバルな敵リストに追加
-		enemy_list.push_back(enemy);
+		// 敵を空間グリッドに追加
+		if (!enemy_grid.check_initialized())
+			enemy_grid.init(rect_tile_map);
+		enemy->set_id_spawn(num_spawned++);
+		enemy_grid.insert(enemy);
 	}
 
 	bool check_cleared()
 	{
-		return enemy_list.empty();
+		return enemy_store.size() == 0;
 	}
 
-	EnemyList &get_enemy_list()
+	const EnemyList &get_enemy_list() const
 	{
-		return enemy_list;
+		return enemy_store.get_enemy_list();
 	}
 
-protected:
-	EnemyManager() = default;
+	const EnemyStore &get_enemy_store() const
+	{
+		return enemy_store;
+	}
 
-	// デストラクタ、すべての敵を破棄
-	~EnemyManager()
+	const EnemyGrid &get_enemy_grid() const
 	{
-		for (Enemy *enemy : enemy_list)
-		{
-			delete enemy;
-		}
+		return enemy_grid;
+	}
+
+protected:
+	// 敵の種類ごとのアーキタイプを作成（設定とリソースの読み込み後、最初の生成より前に一度だけ）
+	EnemyManager()
+	{
+		load_enemy_archetype_list();
 	}
 
+	// デストラクタ、敵オブジェクトはオブジェクトプールと共に解放される
+	~EnemyManager() = default;
+
 private:
-	EnemyList enemy_list; // 敵リスト、現在のすべての敵のポインタを格納
+	ObjectPool<Enemy> enemy_pool; // 敵オブジェクトのプール
+	EnemyStore enemy_store; // 敵のデータ、現在のすべての敵を生成順に格納
+	EnemyGrid enemy_grid; // 空間グリッド、敵をタイル単位のセルに分類して格納
+	Uint64 num_spawned = 0; // これまでに生成した敵の数（生成順の番号に使用）
+
+	// 敵の種類ごとのアーキタイプ（ConfigManager::enemy_template_list と同じ順序）
+	std::vector<EnemyArchetype> enemy_archetype_list;
+
+	// 弾丸との衝突検出用のセル分類（毎刻み作り直す）
+	std::vector<int> idx_bullet_cell_list;		 // 弾丸ごとのセル番号（衝突しない弾丸は-1）
+	std::vector<int> idx_bullet_cell_begin_list; // セルごとの開始位置（セル数 + 1個）
+	std::vector<int> idx_bullet_binned_list;	 // セル順に並べた弾丸のインデックス
 
 private:
+	// ゲーム設定の敵テンプレートからアーキタイプを作成
+	void load_enemy_archetype_list()
+	{
+		const std::vector<ConfigManager::EnemyTemplate> &enemy_template_list = ConfigManager::instance()->enemy_template_list;
+
+		enemy_archetype_list.resize(enemy_template_list.size());
+		for (size_t i = 0; i < enemy_template_list.size(); i++)
+			enemy_archetype_list[i].load(enemy_template_list[i]);
+	}
+
 	// 敵と本拠地の衝突を処理
 	void process_home_collision()
 	{
 		// マップ上の本拠地のインデックス位置を取得
-		static const SDL_Point &idx_home = ConfigManager::instance()->map.get_idx_home();
+		const SDL_Point &idx_home = ConfigManager::instance()->map.get_idx_home();
 		// マップ上の本拠地のインデックス位置を取得
-		static const SDL_Rect &rect_tile_map = ConfigManager::instance()->rect_tile_map;
+		const SDL_Rect &rect_tile_map = ConfigManager::instance()->rect_tile_map;
 		// 本拠地の実際のピクセル位置を計算
-		static const Vector2 position_home_tile =
+		const Vector2 position_home_tile =
 			{
 				(double)rect_tile_map.x + idx_home.x * SIZE_TILE,
 				(double)rect_tile_map.y + idx_home.y * SIZE_TILE,
 			};
 
 		// すべての敵をループし、本拠地との衝突をチェック
-		for (Enemy *enemy : enemy_list)
+		for (EnemyStore::Handle handle = 0; handle < (EnemyStore::Handle)enemy_store.size(); handle++)
 		{
-			if (enemy->can_remove())
+			if (!enemy_store.check_valid(handle))
 				continue;
 
 			// 敵の現在位置を取得
-			const Vector2 &position = enemy->get_position();
+			const Vector2 &position = enemy_store.get_position(handle);
 
 			// 敵が本拠地エリアに入ったかどうかをチェック
 			if (position.x >= position_home_tile.x && position.y >= position_home_tile.y && position.x <= position_home_tile.x + SIZE_TILE && position.y <= position_home_tile.y + SIZE_TILE)
 			{
 				// 敵を無効としてマークし、本拠地のHPを減少させる
-				enemy->make_invalid();
-				HomeManager::instance()->decrease_hp(enemy->get_damage());
+				enemy_store.make_invalid(handle);
+				HomeManager::instance()->decrease_hp(enemy_store.get_enemy(handle)->get_damage());
 			}
 		}
 	}
@@ -209,20 +245,49 @@ private:
 	// 敵と弾丸の衝突を処理
 	void process_bullet_collision()
 	{
+		PROFILE_ZONE("EnemyManager::process_bullet_collision");
+
 		// 現在のゲーム内のすべてのアクティブな弾丸を取得
-		static BulletManager::BulletList &bullet_list = BulletManager::instance()->get_bullet_list();
+		BulletManager::BulletList &bullet_list = BulletManager::instance()->get_bullet_list();
+
+		if (enemy_store.size() == 0 || bullet_list.empty())
+			return;
+
+		// 衝突可能な弾丸を、敵と同じグリッドのセルに分類
+		bin_bullet(bullet_list);
 
 		// 弾丸が敵と衝突しているかどうかを検出
-		for (Enemy *enemy : enemy_list)
+		static thread_local std::vector<int> idx_candidate_list;
+		for (EnemyStore::Handle handle = 0; handle < (EnemyStore::Handle)enemy_store.size(); handle++)
 		{
-			if (enemy->can_remove())
+			if (!enemy_store.check_valid(handle))
 				continue;
 			// 敵のサイズと位置を取得
-			const Vector2 &size_enemy = enemy->get_size();
-			const Vector2 &pos_enemy = enemy->get_position();
+			const Vector2 &size_enemy = enemy_store.get_size(handle);
+			const Vector2 &pos_enemy = enemy_store.get_position(handle);
+			Enemy *enemy = enemy_store.get_enemy(handle);
+
+			// 敵の矩形に重なるセルの弾丸だけを候補とする
+			const int idx_x_min = enemy_grid.get_idx_col(pos_enemy.x - size_enemy.x / 2), idx_x_max = enemy_grid.get_idx_col(pos_enemy.x + size_enemy.x / 2);
+			const int idx_y_min = enemy_grid.get_idx_row(pos_enemy.y - size_enemy.y / 2), idx_y_max = enemy_grid.get_idx_row(pos_enemy.y + size_enemy.y / 2);
+			idx_candidate_list.clear();
+			for (int y = idx_y_min; y <= idx_y_max; y++)
+			{
+				for (int x = idx_x_min; x <= idx_x_max; x++)
+				{
+					const int idx_cell = y * enemy_grid.get_num_col() + x;
+					idx_candidate_list.insert(idx_candidate_list.end(),
+											  idx_bullet_binned_list.begin() + idx_bullet_cell_begin_list[idx_cell],
+											  idx_bullet_binned_list.begin() + idx_bullet_cell_begin_list[idx_cell + 1]);
+				}
+			}
+			// 複数のセルにまたがる場合は、弾丸リストの順序に並べ直す（どの弾丸が先に当たるかを変えないため）
+			if (idx_x_min != idx_x_max || idx_y_min != idx_y_max)
+				std::sort(idx_candidate_list.begin(), idx_candidate_list.end());
 
-			for (Bullet *bullet : bullet_list)
+			for (int idx_bullet : idx_candidate_list)
 			{
+				Bullet *bullet = bullet_list[idx_bullet];
 				if (!bullet->can_collide())
 					continue;
 				// 弾丸の位置を取得
@@ -247,18 +312,15 @@ private:
 					// 範囲ダメージがある場合
 					else
 					{
-						for (Enemy *target_enemy : enemy_list) // 再度すべての敵をループ
+						// 弾丸の位置からダメージ範囲内にいる敵をグリッドから検索
+						static thread_local EnemyList enemy_in_range_list;
+						enemy_grid.query_radius(pos_bullet, damage_range, enemy_in_range_list);
+						for (Enemy *target_enemy : enemy_in_range_list)
 						{
-							const Vector2 &pos_target_enemy = target_enemy->get_position();
-
-							// 範囲チェック（敵の位置と弾丸の位置の距離が弾丸のダメージ範囲以下）
-							if ((pos_target_enemy - pos_bullet).length() <= damage_range)
+							target_enemy->decrease_hp(damage);
+							if (target_enemy->can_remove())
 							{
-								target_enemy->decrease_hp(damage);
-								if (target_enemy->can_remove())
-								{
-									target_enemy->try_spawn_coin_prop(pos_target_enemy, target_enemy->get_reward_ratio());
-								}
+								target_enemy->try_spawn_coin_prop(target_enemy->get_position(), target_enemy->get_reward_ratio());
 							}
 						}
 					}
@@ -269,19 +331,52 @@ private:
 		}
 	}
 
+	// 衝突可能な弾丸のインデックスをセルごとにまとめる（セル内は弾丸リストの順序）
+	void bin_bullet(const BulletManager::BulletList &bullet_list)
+	{
+		const int num_cell = enemy_grid.get_num_col() * enemy_grid.get_num_row();
+		idx_bullet_cell_list.resize(bullet_list.size());
+		idx_bullet_cell_begin_list.assign(num_cell + 1, 0);
+
+		// セルごとの弾丸の数を数える
+		for (size_t i = 0; i < bullet_list.size(); i++)
+		{
+			const Bullet *bullet = bullet_list[i];
+			idx_bullet_cell_list[i] = bullet->can_collide() ? enemy_grid.get_idx_cell(bullet->get_position()) : -1;
+			if (idx_bullet_cell_list[i] >= 0)
+				idx_bullet_cell_begin_list[idx_bullet_cell_list[i] + 1]++;
+		}
+
+		// 累積和から各セルの開始位置を求め、弾丸のインデックスを配置
+		for (int i = 0; i < num_cell; i++)
+			idx_bullet_cell_begin_list[i + 1] += idx_bullet_cell_begin_list[i];
+
+		static thread_local std::vector<int> idx_next_list;
+		idx_next_list.assign(idx_bullet_cell_begin_list.begin(), idx_bullet_cell_begin_list.end() - 1);
+		idx_bullet_binned_list.resize(idx_bullet_cell_begin_list[num_cell]);
+		for (size_t i = 0; i < bullet_list.size(); i++)
+		{
+			if (idx_bullet_cell_list[i] >= 0)
+				idx_bullet_binned_list[idx_next_list[idx_bullet_cell_list[i]]++] = (int)i;
+		}
+	}
+
 	// 無効な敵を削除
 	void remove_invalid_enemy()
 	{
-		// std::remove_if を使用して無効とマークされた敵を削除し、メモリを解放
-		enemy_list.erase(std::remove_if(enemy_list.begin(), enemy_list.end(),
-										[](const Enemy *enemy)
-										{
-											bool deletable = enemy->can_remove();
-											if (deletable)
-												delete enemy;
-											return deletable;
-										}),
-						 enemy_list.end());
+		// 無効とマークされた敵を EnemyStore から削除し、オブジェクトプールに返却
+		const size_t idx_first_moved = enemy_store.remove_invalid(
+			[&](Enemy *enemy)
+			{
+				enemy_grid.remove(enemy);
+				enemy->on_remove();
+				enemy_pool.release(enemy);
+			});
+
+		// 配列が詰められた位置以降の敵のハンドルを付け直す
+		const EnemyList &enemy_list = enemy_store.get_enemy_list();
+		for (size_t i = idx_first_moved; i < enemy_list.size(); i++)
+			enemy_list[i]->set_handle((EnemyStore::Handle)i);
 	}
 };
 
@@ -0,0 +1,287 @@
+#ifndef _ENEMY_STORE_H_
+#define _ENEMY_STORE_H_
+
+/**
+ * @brief 敵データ格納クラス
+ *
+ * このクラスは、毎刻み参照・更新される敵のデータ（位置、速度、HP、経路の進行状況、状態フラグなど）を
+ * 項目ごとの連続した配列（SoA）に格納します。
+ *
+ * 主な機能:
+ * - 敵の追加と、無効な敵の削除（配列を詰めても生成順は維持）
+ * - すべての敵の移動処理（配列を先頭から順に処理）
+ * - ハンドル（配列上の番号）によるデータの読み書き
+ *
+ * 使用方法:
+ * - add() で敵を追加し、返されたハンドルを Enemy に保持させる
+ * - get_position(handle) などでデータを取得し、decrease_hp(handle, val) などで更新
+ *
+ * 注意事項:
+ * - ハンドルは remove_invalid() で無効な敵を削除すると変わるため、呼び出し側で付け直す必要があります
+ * - アニメーション、タイマー、コールバック関数などの頻繁に参照されないデータは Enemy 側に保持します
+ */
+
+#include "vector2.h"
+#include "route.h"
+#include "config_manager.h"
+
+#include <SDL.h>
+#include <vector>
+#include <algorithm>
+
+class Enemy;
+
+class EnemyStore
+{
+public:
+	typedef int Handle;						 // 敵のハンドル（配列上の番号）
+	typedef std::vector<Enemy *> EnemyList; // ハンドル順の敵オブジェクトのリスト
+
+public:
+	EnemyStore() = default;
+	~EnemyStore() = default;
+
+	// 敵を追加し、ハンドルを返す（HPと速度は最大値から開始）
+	Handle add(Enemy *enemy, const Vector2 &size, double max_hp, double max_speed)
+	{
+		enemy_list.push_back(enemy);
+		position_list.emplace_back();
+		velocity_list.emplace_back();
+		direction_list.emplace_back();
+		position_target_list.emplace_back();
+		size_list.push_back(size);
+		hp_list.push_back(max_hp);
+		max_hp_list.push_back(max_hp);
+		speed_list.push_back(max_speed);
+		route_list.push_back(nullptr);
+		idx_target_list.push_back(0);
+		is_valid_list.push_back(true);
+
+		return (Handle)enemy_list.size() - 1;
+	}
+
+	// 無効な敵を削除し、生成順を保ったまま配列を詰める
+	// 削除する敵ごとに on_remove(enemy) を呼び出し、ハンドルが変わった最初の番号を返す
+	template <typename Callback>
+	size_t remove_invalid(Callback on_remove)
+	{
+		size_t idx_first_moved = enemy_list.size();
+		size_t idx_dst = 0;
+		for (size_t idx_src = 0; idx_src < enemy_list.size(); idx_src++)
+		{
+			if (!is_valid_list[idx_src])
+			{
+				on_remove(enemy_list[idx_src]);
+				idx_first_moved = std::min(idx_first_moved, idx_src);
+				continue;
+			}
+			if (idx_dst != idx_src)
+				move_slot(idx_src, idx_dst);
+			idx_dst++;
+		}
+
+		resize(idx_dst);
+		return idx_first_moved;
+	}
+
+	// すべての敵を移動（速度と経路に基づいて位置を更新し、次の刻みの速度を計算）
+	void update_movement(double delta)
+	{
+		const SDL_Rect &rect_tile_map = ConfigManager::instance()->rect_tile_map;
+
+		for (size_t i = 0; i < enemy_list.size(); i++)
+		{
+			Vector2 &position = position_list[i];
+			Vector2 &direction = direction_list[i];
+			Vector2 &velocity = velocity_list[i];
+			Vector2 &position_target = position_target_list[i];
+
+			/*速度とフレーム間隔に基づいて移動距離を計算*/
+			Vector2 move_distance = velocity * delta;			  // 現在のフレームの最大移動距離
+			Vector2 target_distance = position_target - position; // 現在のフレームから目標点までの距離
+
+			// 目標点に近づいたかどうかを判断
+			if (target_distance.approx_zero())
+			{
+				idx_target_list[i]++;									  // 目標点のインデックスを更新
+				refresh_position_target((Handle)i, rect_tile_map);	  // 次の目標位置を更新
+				direction = (position_target - position).normalize(); // 移動方向を更新
+			}
+
+			position += move_distance < target_distance ? move_distance : target_distance; // 実際の移動距離
+			// 速度を計算、方向 * 速度 * 単一グリッドの距離
+			velocity.x = direction.x * speed_list[i] * SIZE_TILE;
+			velocity.y = direction.y * speed_list[i] * SIZE_TILE;
+		}
+	}
+
+	size_t size() const
+	{
+		return enemy_list.size();
+	}
+
+	const EnemyList &get_enemy_list() const
+	{
+		return enemy_list;
+	}
+
+	Enemy *get_enemy(Handle handle) const
+	{
+		return enemy_list[handle];
+	}
+
+	void set_position(Handle handle, const Vector2 &position)
+	{
+		position_list[handle] = position;
+	}
+
+	const Vector2 &get_position(Handle handle) const
+	{
+		return position_list[handle];
+	}
+
+	const Vector2 &get_velocity(Handle handle) const
+	{
+		return velocity_list[handle];
+	}
+
+	const Vector2 &get_size(Handle handle) const
+	{
+		return size_list[handle];
+	}
+
+	void set_route(Handle handle, const Route *route)
+	{
+		const SDL_Rect &rect_tile_map = ConfigManager::instance()->rect_tile_map;
+
+		route_list[handle] = route;
+		refresh_position_target(handle, rect_tile_map);
+	}
+
+	// 敵の進行度（大きいほど防御点に近い）
+	double get_route_process(Handle handle) const
+	{
+		const Route::IdxList &idx_list = route_list[handle]->get_idx_list();
+		if (idx_list.size() == 1)
+		{
+			return 1;
+		}
+		return (double)idx_target_list[handle] / (idx_list.size() - 1);
+	}
+
+	double get_hp(Handle handle) const
+	{
+		return hp_list[handle];
+	}
+
+	double get_max_hp(Handle handle) const
+	{
+		return max_hp_list[handle];
+	}
+
+	void increase_hp(Handle handle, double val)
+	{
+		double &hp = hp_list[handle];
+		hp += val;
+		if (hp > max_hp_list[handle])
+		{
+			hp = max_hp_list[handle];
+		}
+	}
+
+	void decrease_hp(Handle handle, double val)
+	{
+		double &hp = hp_list[handle];
+		hp -= val;
+		if (hp <= 0)
+		{
+			hp = 0;
+			is_valid_list[handle] = false;
+		}
+	}
+
+	void set_speed(Handle handle, double val)
+	{
+		speed_list[handle] = val;
+	}
+
+	void make_invalid(Handle handle)
+	{
+		is_valid_list[handle] = false;
+	}
+
+	bool check_valid(Handle handle) const
+	{
+		return is_valid_list[handle];
+	}
+
+private:
+	EnemyList enemy_list; // 敵オブジェクト（アニメーションなどのデータを保持）
+
+	// 位置と移動
+	std::vector<Vector2> position_list;
+	std::vector<Vector2> velocity_list;
+	std::vector<Vector2> direction_list;
+	std::vector<Vector2> position_target_list; // 移動の目標位置(ワールド座標)
+	std::vector<Vector2> size_list;
+
+	// HPと速度
+	std::vector<double> hp_list;
+	std::vector<double> max_hp_list;
+	std::vector<double> speed_list;
+
+	// 経路探索関連
+	std::vector<const Route *> route_list;
+	std::vector<int> idx_target_list;
+
+	// 敵が倒されていないかどうか
+	std::vector<bool> is_valid_list;
+
+private:
+	void refresh_position_target(Handle handle, const SDL_Rect &rect_tile_map)
+	{
+		const Route::IdxList &idx_list = route_list[handle]->get_idx_list();
+		if (idx_target_list[handle] < idx_list.size())
+		{
+			const SDL_Point &point = idx_list[idx_target_list[handle]];
+
+			position_target_list[handle].x = rect_tile_map.x + point.x * SIZE_TILE + SIZE_TILE / 2;
+			position_target_list[handle].y = rect_tile_map.y + point.y * SIZE_TILE + SIZE_TILE / 2;
+		}
+	}
+
+	// idx_src番目のデータをidx_dst番目に移動
+	void move_slot(size_t idx_src, size_t idx_dst)
+	{
+		enemy_list[idx_dst] = enemy_list[idx_src];
+		position_list[idx_dst] = position_list[idx_src];
+		velocity_list[idx_dst] = velocity_list[idx_src];
+		direction_list[idx_dst] = direction_list[idx_src];
+		position_target_list[idx_dst] = position_target_list[idx_src];
+		size_list[idx_dst] = size_list[idx_src];
+		hp_list[idx_dst] = hp_list[idx_src];
+		max_hp_list[idx_dst] = max_hp_list[idx_src];
+		speed_list[idx_dst] = speed_list[idx_src];
+		route_list[idx_dst] = route_list[idx_src];
+		idx_target_list[idx_dst] = idx_target_list[idx_src];
+		is_valid_list[idx_dst] = is_valid_list[idx_src];
+	}
+
+	void resize(size_t num)
+	{
+		enemy_list.resize(num);
+		position_list.resize(num);
+		velocity_list.resize(num);
+		direction_list.resize(num);
+		position_target_list.resize(num);
+		size_list.resize(num);
+		hp_list.resize(num);
+		max_hp_list.resize(num);
+		speed_list.resize(num);
+		route_list.resize(num);
+		idx_target_list.resize(num);
+		is_valid_list.resize(num);
+	}
+};
+
+#endif // !_ENEMY_STORE_H_
@@ -1,12 +0,0 @@
-#ifndef _ENEMY_TYPE_H_
-#define _ENEMY_TYPE_H_
-
-enum class EnemyType
-{
-	Slim,
-	KingSlim,
-	Skeleton,
-	Goblin,
-	GoblinPriest
-};
-#endif // !_ENEMY_TYPE_H_
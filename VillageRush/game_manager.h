@@ -22,22 +22,39 @@
 
 #include "manager.h"
 #include "config_manager.h"
+#include "archive_manager.h"
+#include "compiled_level.h"
 #include "resources_manager.h"
 #include "enemy_manager.h"
 #include "wave_manager.h"
 #include "tower_manager.h"
 #include "bullet_manager.h"
 #include "player_manager.h"
+#include "timer_manager.h"
+#include "sprite_batch_manager.h"
+#include "primitive_cache_manager.h"
 #include "status_bar.h"
 #include "panel.h"
 #include "place_panel.h"
 #include "upgrade_panel.h"
 #include "banner.h"
+#include "perf_overlay.h"
+#include "random_manager.h"
+#include "replay_manager.h"
+#include "profile_manager.h"
+#include "alloc_counter.h"
 
 #include <SDL.h>
 #include <SDL_ttf.h>
 #include <SDL_image.h>
 #include <SDL_mixer.h>
+#include <cmath>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <iostream>
 
 class GameManager : public Manager<GameManager>
 {
@@ -46,34 +63,82 @@ class GameManager : public Manager<GameManager>
 public:
 	int run(int argc, char **argv)
 	{
-		
+		// 乱数シードの設定
+		init_random_seed(argc, argv);
+
+		// 入力の記録・再生の設定（再生時はシードと刻みレートを記録ファイルの値で上書き）
+		if (!init_replay(argc, argv))
+			return -1;
+
+		// ヘッドレスモードの場合、レンダリングを行わないシミュレーション専用のループを実行
+		if (ConfigManager::instance()->is_headless)
+			return run_headless(argc, argv);
 
 		// BGMをフェードインで再生
 		Mix_FadeInMusic(ResourcesManager::instance()->get_music_pool().find(ResID::Music_BGM)->second, -1, 1500);
 
-		// SDLの高精度タイマーとタイマーの刻みを取得し、フレームレート制御に使用
+		// SDLの高精度タイマーとタイマーの刻みを取得し、経過時間の計測に使用
 		Uint64 last_counter = SDL_GetPerformanceCounter();
 		const Uint64 counter_freq = SDL_GetPerformanceFrequency();
 
+		// シミュレーションは固定刻みで進め、描画レート（垂直同期）とは切り離す
+		const ConfigManager::BasicTemplate &basic_template = ConfigManager::instance()->basic_template;
+		const double delta_tick = 1.0 / basic_template.tick_rate;
+		double accumulator = 0; // まだシミュレーションに反映していない経過時間
+
+		ReplayManager *replay_manager = ReplayManager::instance();
+		ProfileManager *profile_manager = ProfileManager::instance();
+
 		while (!is_quit)
 		{
-			// ユーザー入力の処理
+			profile_manager->on_frame_begin();
+			PROFILE_ZONE("GameManager::frame");
+
+			// パフォーマンスオーバーレイ用に、フレーム内の各段階の開始時刻を記録
+			const Uint64 counter_frame_begin = SDL_GetPerformanceCounter();
+
+			// ユーザー入力の処理（記録中は処理する前に現在の刻み番号とともに記録）
 			while (SDL_PollEvent(&event))
 			{
+				// レンダーターゲットの内容が失われた場合、キャッシュした図形のテクスチャを作成し直す（入力ではないため記録しない）
+				if (event.type == SDL_RENDER_TARGETS_RESET || event.type == SDL_RENDER_DEVICE_RESET)
+				{
+					PrimitiveCacheManager::instance()->clear();
+					continue;
+				}
+
+				// 再生中はウィンドウを閉じる操作のみ受け付け、その他の入力は記録ファイルから再生する
+				if (replay_manager->is_replaying() && event.type != SDL_QUIT)
+					continue;
+
+				replay_manager->record(idx_tick, event);
 				on_input();
 			}
 
-			// フレームレートの制御
+			// 前フレームからの経過時間を蓄積
 			Uint64 current_counter = SDL_GetPerformanceCounter();
-			double delta = (double)(current_counter - last_counter) / counter_freq;
+			accumulator += (double)(current_counter - last_counter) / counter_freq;
 			last_counter = current_counter;
-			if (delta * 1000.f < 1000.f / 60)
+
+			// データの更新（蓄積時間が刻み幅に達するごとに1刻み進める）
+			int num_tick = 0;
+			while (accumulator >= delta_tick && num_tick < basic_template.max_catch_up_ticks)
 			{
-				SDL_Delay((Uint32)(1000.f / 60 - delta * 1000));
+				process_replay_input();
+				on_update(delta_tick);
+				idx_tick++;
+				accumulator -= delta_tick;
+				num_tick++;
 			}
 
-			// データの更新
-			on_update(delta);
+			// 上限に達した場合は残りの遅れを切り捨て、長時間の停止後に追いつき処理が連鎖しないようにする
+			if (accumulator >= delta_tick)
+				accumulator = std::fmod(accumulator, delta_tick);
+
+			const Uint64 counter_update_end = SDL_GetPerformanceCounter();
+
+			// UIの更新（描画フレームごとに1回）
+			on_update_ui();
 
 			// レンダリングの準備
 			SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
@@ -81,33 +146,198 @@ public:
 
 			// 現在のフレームの内容をレンダリング
 			on_render();
+			perf_overlay.on_render(renderer);
+
+			const Uint64 counter_render_end = SDL_GetPerformanceCounter();
 
-			// レンダリングの実行
+			// レンダリングの実行（垂直同期の待ち時間を含む）
 			SDL_RenderPresent(renderer);
+
+			const Uint64 counter_present_end = SDL_GetPerformanceCounter();
+			perf_overlay.on_frame((double)(counter_present_end - counter_frame_begin) / counter_freq,
+								  (double)(counter_update_end - counter_frame_begin) / counter_freq,
+								  (double)(counter_render_end - counter_update_end) / counter_freq,
+								  (double)(counter_present_end - counter_render_end) / counter_freq);
 		}
+
+		replay_manager->stop();
+		profile_manager->stop_capture();
 		return 0;
 	}
 
+	// コマンドライン引数「--trace FILE」「--trace-frames N」に従い、トレースの記録を開始（既定は300フレーム）
+	// リソースの読み込みも記録できるよう、GameManagerのインスタンス作成前に呼び出す
+	static void init_profile(int argc, char **argv)
+	{
+		std::string path_trace;
+		int num_frame = 300;
+		for (int i = 1; i + 1 < argc; i++)
+		{
+			const std::string arg = argv[i];
+			if (arg == "--trace")
+				path_trace = argv[i + 1];
+			else if (arg == "--trace-frames")
+				num_frame = std::max(1, std::atoi(argv[i + 1]));
+		}
+
+		if (path_trace.empty())
+			return;
+
+#ifdef NDEBUG
+		std::cerr << u8"リリースビルドでは計測ゾーンが無効のため、トレースは空になります" << std::endl;
+#endif
+		ProfileManager::instance()->start_capture(path_trace, num_frame);
+	}
+
+	// 現在のスレッドにヘッドレスのゲームワールドを作成（設定ファイルの読み込みを含む）
+	static GameManager *create_headless_world()
+	{
+		ConfigManager::instance()->is_headless = true;
+		return GameManager::instance();
+	}
+
+	// 現在のスレッドのすべてのマネージャーを破棄（GameManagerはデストラクタで設定を参照するため最初に破棄）
+	// マネージャーやそのデータへのポインタは関数内の静的変数に保持していないため、破棄後に同じスレッドで新しいワールドを作成できる
+	static void destroy_world()
+	{
+		GameManager::destroy();
+		WaveManager::destroy();
+		EnemyManager::destroy();
+		BulletManager::destroy();
+		TowerManager::destroy();
+		CoinManager::destroy();
+		HomeManager::destroy();
+		PlayerManager::destroy();
+		TimerManager::destroy(); // エンティティ（WorldTimer）を破棄した後に破棄する
+		SpriteBatchManager::destroy(); // バッチが描画まで SDL_Texture* を保持するため、テクスチャ（ResourcesManager）より先に破棄する
+		PrimitiveCacheManager::destroy();
+		ReplayManager::destroy();
+		ProfileManager::destroy();
+		RandomManager::destroy();
+		ResourcesManager::destroy();
+		ConfigManager::destroy();
+		ArchiveManager::destroy(); // 音楽・フォントがアーカイブのメモリを参照するため最後に破棄する
+	}
+
+	// ヘッドレスでゲームワールドを最大max_ticks刻みまで進め、結果（"win"・"loss"・"quit"・"timeout"）を返す
+	const char *simulate(Uint64 max_ticks)
+	{
+		ConfigManager *config = ConfigManager::instance();
+		const double delta = 1.0 / config->basic_template.tick_rate;
+
+		const bool is_replaying = ReplayManager::instance()->is_replaying();
+		ProfileManager *profile_manager = ProfileManager::instance();
+		while (!config->is_game_over && !is_quit && idx_tick < max_ticks)
+		{
+			// ヘッドレスモードでは1刻みを1フレームとして記録
+			profile_manager->on_frame_begin();
+			PROFILE_ZONE("GameManager::tick");
+
+			// 再生中は、クリック処理が参照するパネルの表示値（コストなど）を先に更新しておく
+			if (is_replaying)
+			{
+				place_panel->on_update(nullptr);
+				upgrade_panel->on_update(nullptr);
+			}
+			process_replay_input();
+			if (is_quit)
+				break;
+
+			process_build_order(idx_tick);
+			on_update_world(delta);
+			idx_tick++;
+		}
+
+		profile_manager->stop_capture();
+		return !config->is_game_over ? (is_quit ? "quit" : "timeout") : (config->is_game_win ? "win" : "loss");
+	}
+
+	// これまでに実行したシミュレーションの刻み数を取得
+	Uint64 get_tick() const
+	{
+		return idx_tick;
+	}
+
+	// 建設指示の文字列（例："archer:10:3@600"）を解析し、建設指示リストに追加
+	bool parse_build_order(const std::string &str)
+	{
+		std::string str_type, str_x, str_y, str_tick;
+		std::stringstream str_stream(str);
+		if (!std::getline(str_stream, str_type, ':') || !std::getline(str_stream, str_x, ':') || !std::getline(str_stream, str_y, '@'))
+			return false;
+		std::getline(str_stream, str_tick);
+
+		BuildOrder order;
+		if (str_type == "archer")
+			order.type = TowerType::Archer;
+		else if (str_type == "axeman")
+			order.type = TowerType::Axeman;
+		else if (str_type == "gunner")
+			order.type = TowerType::Gunner;
+		else
+			return false;
+
+		order.idx_tile.x = std::atoi(str_x.c_str());
+		order.idx_tile.y = std::atoi(str_y.c_str());
+		order.tick = str_tick.empty() ? 0 : std::strtoull(str_tick.c_str(), nullptr, 10);
+
+		// マップ範囲外、または防御塔を設置できないタイルの場合は不正とする
+		const Map &map = ConfigManager::instance()->map;
+		if (order.idx_tile.x < 0 || order.idx_tile.y < 0 || order.idx_tile.x >= (int)map.get_width() || order.idx_tile.y >= (int)map.get_height())
+			return false;
+		if (check_home(order.idx_tile) || !can_place_tower(order.idx_tile))
+			return false;
+
+		build_order_list.push_back(order);
+		return true;
+	}
+
 protected:
 	GameManager()
 	{
-		// SDLと関連コンポーネントの初期化
-		init_assert(!SDL_Init(SDL_INIT_EVERYTHING), u8"SDL2の初期化に失敗しました");
-		init_assert(IMG_Init(IMG_INIT_JPG | IMG_INIT_PNG), u8"SDL_imageの初期化に失敗しました");
-		init_assert(Mix_Init(MIX_INIT_MP3), u8"SDL_mixerの初期化に失敗しました");
-		init_assert(!TTF_Init(), u8"SDL_ttfの初期化に失敗しました");
+		ConfigManager *config = ConfigManager::instance();
 
-		// オーディオの初期化
-		Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 2048);
+		// SDLと関連コンポーネントの初期化（ヘッドレスモードでは不要）
+		if (!config->is_headless)
+		{
+			init_assert(!SDL_Init(SDL_INIT_EVERYTHING), u8"SDL2の初期化に失敗しました");
+			init_assert(IMG_Init(IMG_INIT_JPG | IMG_INIT_PNG), u8"SDL_imageの初期化に失敗しました");
+			init_assert(Mix_Init(MIX_INIT_MP3), u8"SDL_mixerの初期化に失敗しました");
+			init_assert(!TTF_Init(), u8"SDL_ttfの初期化に失敗しました");
 
-		// IMEのUIを表示するように設定
-		SDL_SetHint(SDL_HINT_IME_SHOW_UI, "1");
+			// オーディオの初期化
+			Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 2048);
 
-		// 設定情報の読み込み
-		ConfigManager *config = ConfigManager::instance();
-		init_assert(config->map.load("map.csv"), u8"ゲームマップの読み込みに失敗しました");
-		init_assert(config->load_level_config("level.json"), u8"レベル設定の読み込みに失敗しました");
-		init_assert(config->load_game_config("config.json"), u8"ゲーム設定の読み込みに失敗しました");
+			// IMEのUIを表示するように設定
+			SDL_SetHint(SDL_HINT_IME_SHOW_UI, "1");
+		}
+
+		// アセットアーカイブを開く（存在しない場合は個別のファイルから読み込む）
+		ArchiveManager::instance()->open("resources.pak");
+
+		// 設定情報の読み込み（コンパイル済みレベルがない場合はテキスト形式のファイルから読み込む）
+		if (!CompiledLevel::load("level.bin", *config))
+		{
+			init_assert(config->map.load("map.csv"), u8"ゲームマップの読み込みに失敗しました");
+			// （レベル設定の敵の名前を敵の種類に変換するため、ゲーム設定を先に読み込む）
+			init_assert(config->load_game_config("config.json"), u8"ゲーム設定の読み込みに失敗しました");
+			init_assert(config->load_level_config("level.json"), u8"レベル設定の読み込みに失敗しました");
+		}
+
+		// ヘッドレスモードではウィンドウ・レンダラー・リソースを作成せず、タイルマップの境界矩形のみを計算
+		if (config->is_headless)
+		{
+			config->update_rect_tile_map();
+
+			// 敵のアーキタイプと防御塔・弾のアニメーションクリップを読み込み時に作成
+			EnemyManager::instance();
+			TowerManager::instance();
+			BulletManager::instance();
+
+			place_panel = new PlacePanel();
+			upgrade_panel = new UpgradePanel();
+			return;
+		}
 
 		// 設定情報を使用してウィンドウを作成
 		window = SDL_CreateWindow(config->basic_template.window_title.c_str(), SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED,
@@ -118,12 +348,19 @@ protected:
 		renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC | SDL_RENDERER_TARGETTEXTURE);
 		init_assert(renderer, u8"レンダラーの作成に失敗しました");
 
-		// ゲームリソースの読み込み
-		init_assert(ResourcesManager::instance()->load_from_file(renderer), u8"ゲームリソースの読み込みに失敗しました");
+		// ゲームリソースの読み込み（デコードの完了を待つ間、ロード画面に進捗を表示）
+		init_assert(ResourcesManager::instance()->load_from_file(renderer, [&](double progress)
+																 { on_render_loading(progress); }),
+					u8"ゲームリソースの読み込みに失敗しました");
 
 		// タイルマップテクスチャの生成
 		init_assert(generate_tile_map_texture(), u8"タイルマップテクスチャの生成に失敗しました");
 
+		// 敵のアーキタイプと防御塔・弾のアニメーションクリップを読み込み時に作成（テクスチャアトラス上の矩形を参照するため、リソースの読み込み後）
+		EnemyManager::instance();
+		TowerManager::instance();
+		BulletManager::instance();
+
 		// ステータスバーの位置設定
 		status_bar.set_position(15, 15);
 
@@ -133,10 +370,22 @@ protected:
 
 		// 結果バナーの初期化
 		banner = new Banner();
+
+		// パフォーマンスオーバーレイの初期化（F3キーで表示を切り替え）
+		perf_overlay.init(renderer);
+		perf_overlay.set_time_budget(1.0 / config->basic_template.tick_rate);
 	}
 
 	~GameManager()
 	{
+		delete place_panel;
+		delete upgrade_panel;
+		delete banner;
+
+		// ヘッドレスモードではSDLを初期化していないため、終了処理は不要
+		if (ConfigManager::instance()->is_headless)
+			return;
+
 		// リソースの解放
 		SDL_DestroyRenderer(renderer);
 		SDL_DestroyWindow(window);
@@ -152,17 +401,35 @@ private:
 	SDL_Event event;
 	bool is_quit = false;
 
+	Uint64 idx_tick = 0; // これまでに実行したシミュレーションの刻み数（入力の記録・再生の時刻として使用）
+	bool is_game_over_last_tick = false; // 前の刻みでゲームが終了していたかどうか（終了時の効果音を一度だけ再生するため）
+
+	SDL_Point pos_center = {0};		   // マウスクリックで選択されたタイルの中心位置
+	SDL_Point idx_tile_selected = {0}; // マウスクリックで選択されたタイルのインデックス
+
+	Uint64 time_last_render_loading = 0; // ロード画面を最後に描画した時刻
+
 	SDL_Window *window = nullptr;
 	SDL_Renderer *renderer = nullptr;
 
 	SDL_Texture *tex_tile_map = nullptr;
 
 	StatusBar status_bar;
+	PerfOverlay perf_overlay;
 	Panel *place_panel = nullptr;
 	Panel *upgrade_panel = nullptr;
 
 	Banner *banner = nullptr;
 
+	// ヘッドレスモードでの防御塔の建設指示
+	struct BuildOrder
+	{
+		TowerType type = TowerType::Archer; // 防御塔のタイプ
+		SDL_Point idx_tile = {0};			// 設置するタイルのインデックス
+		Uint64 tick = 0;					// この刻み以降、コインが足りた時点で設置する
+	};
+	std::vector<BuildOrder> build_order_list;
+
 private:
 	// 初期化時のアサーション
 	void init_assert(bool flag, const char *err_msg)
@@ -170,17 +437,160 @@ private:
 		if (flag)
 			return;
 
-		SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_ERROR, u8"ゲームの起動に失敗しました", err_msg, window);
+		report_error(err_msg);
 		exit(-1);
 	}
 
+	// エラーメッセージの表示（ヘッドレスモードではメッセージボックスを表示できないため、標準エラー出力に表示）
+	void report_error(const char *err_msg)
+	{
+		if (ConfigManager::instance()->is_headless)
+			std::cerr << u8"ゲームの起動に失敗しました: " << err_msg << std::endl;
+		else
+			SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_ERROR, u8"ゲームの起動に失敗しました", err_msg, window);
+	}
+
+	// 乱数シードを設定（優先順位：コマンドライン引数「--seed N」> 設定ファイルの「seed」> 起動ごとにランダム）
+	void init_random_seed(int argc, char **argv)
+	{
+		long long seed = ConfigManager::instance()->basic_template.seed;
+		for (int i = 1; i + 1 < argc; i++)
+		{
+			if (std::string(argv[i]) == "--seed")
+				seed = std::strtoll(argv[i + 1], nullptr, 10);
+		}
+
+		if (seed >= 0)
+			RandomManager::instance()->set_seed((uint32_t)seed);
+	}
+
+	// コマンドライン引数「--record FILE」「--replay FILE」に従い、入力の記録または再生を開始
+	bool init_replay(int argc, char **argv)
+	{
+		ConfigManager *config = ConfigManager::instance();
+		ReplayManager *replay_manager = ReplayManager::instance();
+
+		for (int i = 1; i + 1 < argc; i++)
+		{
+			const std::string arg = argv[i];
+			if (arg == "--replay")
+			{
+				if (!replay_manager->start_replay(argv[i + 1]))
+				{
+					report_error(u8"リプレイファイルの読み込みに失敗しました");
+					return false;
+				}
+
+				// 記録時と同じシードと刻みレートで実行しないと結果が再現されない
+				RandomManager::instance()->set_seed(replay_manager->get_seed());
+				config->basic_template.tick_rate = replay_manager->get_tick_rate();
+				return true;
+			}
+			// ヘッドレスモードにはユーザー入力がないため、記録は行わない
+			else if (arg == "--record" && !config->is_headless)
+			{
+				if (!replay_manager->start_record(argv[i + 1], RandomManager::instance()->get_seed(), config->basic_template.tick_rate))
+				{
+					report_error(u8"リプレイファイルの作成に失敗しました");
+					return false;
+				}
+				return true;
+			}
+		}
+
+		return true;
+	}
+
+	// 現在の刻みに記録された入力イベントを再生
+	void process_replay_input()
+	{
+		ReplayManager *replay_manager = ReplayManager::instance();
+		while (replay_manager->poll(idx_tick, event))
+			on_input();
+	}
+
+	// ヘッドレスモードのメインループ（待機やレンダリングを行わず、CPUが許す限りの速度でレベルを最後まで進める）
+	int run_headless(int argc, char **argv)
+	{
+		ConfigManager *config = ConfigManager::instance();
+
+		// シミュレーションの刻み幅（ウィンドウモードと同じ固定刻み）と、終了しない場合に備えた最大刻み数（1時間分）
+		const double delta = 1.0 / config->basic_template.tick_rate;
+		Uint64 max_ticks = (Uint64)config->basic_template.tick_rate * 60 * 60;
+
+		// コマンドライン引数の解析
+		for (int i = 1; i < argc; i++)
+		{
+			const std::string arg = argv[i];
+			if (arg == "--max-ticks" && i + 1 < argc)
+			{
+				max_ticks = std::strtoull(argv[++i], nullptr, 10);
+			}
+			else if ((arg == "--seed" || arg == "--replay" || arg == "--trace" || arg == "--trace-frames") && i + 1 < argc)
+			{
+				i++; // init_random_seed()・init_replay()・init_profile()で設定済み
+			}
+			else if (arg == "--tower" && i + 1 < argc)
+			{
+				if (!parse_build_order(argv[++i]))
+				{
+					std::cerr << u8"防御塔の建設指示が不正です: " << argv[i] << std::endl;
+					return -1;
+				}
+			}
+			else
+			{
+				std::cerr << "usage: " << argv[0] << " [--seed N] [--replay FILE] [--trace FILE [--trace-frames N]] [--max-ticks N] [--tower archer|axeman|gunner:X:Y[@TICK]]..." << std::endl;
+				return -1;
+			}
+		}
+
+		// シミュレーションの実行
+		const auto time_begin = std::chrono::steady_clock::now();
+		const char *str_result = simulate(max_ticks);
+		const std::chrono::duration<double> time_wall = std::chrono::steady_clock::now() - time_begin;
+
+		// 結果の出力
+		std::cout << "result: " << str_result << std::endl;
+		std::cout << "seed: " << RandomManager::instance()->get_seed() << std::endl;
+		std::cout << "hp: " << HomeManager::instance()->get_current_hp_num() << std::endl;
+		std::cout << "coin: " << CoinManager::instance()->get_current_coin_num() << std::endl;
+		std::cout << "ticks: " << idx_tick << std::endl;
+		std::cout << "sim_time: " << idx_tick * delta << std::endl;
+		std::cout << "wall_time: " << time_wall.count() << std::endl;
+
+		return 0;
+	}
+
+	// 指定刻みに達し、コインが足りる建設指示を実行（配置パネルのクリック処理と同じ規則）
+	void process_build_order(Uint64 tick)
+	{
+		CoinManager *coin_manager = CoinManager::instance();
+		TowerManager *tower_manager = TowerManager::instance();
+
+		for (auto itor = build_order_list.begin(); itor != build_order_list.end();)
+		{
+			double cost = tower_manager->get_place_cost(itor->type);
+			if (itor->tick > tick || cost > coin_manager->get_current_coin_num())
+			{
+				++itor;
+				continue;
+			}
+
+			// 同じタイルへの重複指示は無視する
+			if (can_place_tower(itor->idx_tile))
+			{
+				tower_manager->place_tower(itor->type, itor->idx_tile);
+				coin_manager->decrease_coin(cost);
+			}
+			itor = build_order_list.erase(itor);
+		}
+	}
+
 	// 入力処理
 	void on_input()
 	{
-		// マウスクリックの中心位置と選択されたタイルのインデックスを静的に保存
-		static SDL_Point pos_center;
-		static SDL_Point idx_tile_selected;
-		static ConfigManager *instance = ConfigManager::instance();
+		ConfigManager *instance = ConfigManager::instance();
 
 		// SDLイベントタイプに基づいて異なる入力処理を行う
 		switch (event.type)
@@ -188,6 +598,11 @@ private:
 		case SDL_QUIT:
 			is_quit = true;
 			break;
+		case SDL_KEYDOWN:
+			// パフォーマンスオーバーレイの表示切り替え
+			if (event.key.keysym.sym == SDLK_F3)
+				perf_overlay.toggle();
+			break;
 		case SDL_MOUSEBUTTONDOWN:
 
 			// ゲームが終了している場合は処理をスキップ
@@ -230,25 +645,16 @@ private:
 		}
 	}
 
-	// ゲーム状態の更新
+	// ゲーム状態の更新（固定刻みごとに呼び出される）
 	void on_update(double delta)
 	{
-		static bool is_game_over_last_tick = false;
+		PROFILE_ZONE("GameManager::on_update");
 
-		static ConfigManager *instance = ConfigManager::instance();
+		ConfigManager *instance = ConfigManager::instance();
 		if (!instance->is_game_over)
 		{
-			// 各マネージャーとUIの更新
-			status_bar.on_update(renderer);
-			place_panel->on_update(renderer);
-			upgrade_panel->on_update(renderer);
-
-			WaveManager::instance()->on_update(delta);
-			EnemyManager::instance()->on_update(delta);
-			BulletManager::instance()->on_update(delta);
-			TowerManager::instance()->on_update(delta);
-			CoinManager::instance()->on_update(delta);
-			PlayerManager::instance()->on_update(delta);
+			// 各マネージャーの更新
+			on_update_world(delta);
 
 			return;
 		}
@@ -256,7 +662,7 @@ private:
 		// 前のフレームでゲームが終了していなかったが、このフレームで終了した場合
 		if (!is_game_over_last_tick && instance->is_game_over)
 		{
-			static const ResourcesManager::SoundPool &sounld_pool = ResourcesManager::instance()->get_sound_pool();
+			const ResourcesManager::SoundPool &sounld_pool = ResourcesManager::instance()->get_sound_pool();
 
 			// BGMをフェードアウトし、勝利または敗北の効果音を再生
 			Mix_FadeOutMusic(1500);
@@ -273,20 +679,57 @@ private:
 		}
 	}
 
+	// UIの更新（表示するテキストの更新のみのため、刻みごとではなく描画フレームごとに1回呼び出す）
+	void on_update_ui()
+	{
+		PROFILE_ZONE("GameManager::on_update_ui");
+
+		ConfigManager *instance = ConfigManager::instance();
+		if (instance->is_game_over)
+			return;
+
+		status_bar.on_update(renderer);
+		place_panel->on_update(renderer);
+		upgrade_panel->on_update(renderer);
+	}
+
+	// ゲームワールド（ウェーブ・敵・弾丸・防御塔・コイン・プレイヤー）の更新
+	void on_update_world(double delta)
+	{
+		[[maybe_unused]] const size_t num_alloc_begin = AllocCounter::get_num_alloc();
+
+		TimerManager::instance()->on_update(delta); // 敵・防御塔・コインのタイマーを先に処理
+		WaveManager::instance()->on_update(delta);
+		EnemyManager::instance()->on_update(delta);
+		BulletManager::instance()->on_update(delta);
+		TowerManager::instance()->on_update(delta);
+		CoinManager::instance()->on_update(delta);
+		PlayerManager::instance()->on_update(delta);
+
+		// この刻みのヒープ確保回数（プールやリストの容量が足りている定常状態では0になる）
+		PROFILE_COUNTER("GameManager::num_heap_alloc", AllocCounter::get_num_alloc() - num_alloc_begin);
+	}
+
 	// ゲーム画面のレンダリング
 	void on_render()
 	{
-		static ConfigManager *instance = ConfigManager::instance();
-		static SDL_Rect &rect_dst = instance->rect_tile_map;
+		PROFILE_ZONE("GameManager::on_render");
+
+		ConfigManager *instance = ConfigManager::instance();
+		SDL_Rect &rect_dst = instance->rect_tile_map;
 		SDL_RenderCopy(renderer, tex_tile_map, nullptr, &rect_dst);
 
-		// 各マネージャーのレンダリング
+		// 各マネージャーのレンダリング（スプライトはマネージャーごとにテクスチャ単位でまとめて描画される）
+		SpriteBatchManager *sprite_batch = SpriteBatchManager::instance();
+		sprite_batch->reset_num_draw_call();
+
 		EnemyManager::instance()->on_render(renderer);
 		BulletManager::instance()->on_render(renderer);
 		TowerManager::instance()->on_render(renderer);
 		CoinManager::instance()->on_render(renderer);
 
 		PlayerManager::instance()->on_render(renderer);
+		PROFILE_COUNTER("SpriteBatchManager::num_draw_call", sprite_batch->get_num_draw_call());
 		if (!instance->is_game_over)
 		{
 			// ゲーム中のUIレンダリング
@@ -303,6 +746,35 @@ private:
 		banner->on_render(renderer);
 	}
 
+	// ロード画面（画面中央の進捗バー）のレンダリング
+	void on_render_loading(double progress)
+	{
+		static const int width_bar = 400, height_bar = 16;
+		static const SDL_Color color_background = {48, 40, 51, 255};  // 背景の色（ダークグレー）
+		static const SDL_Color color_foreground = {144, 121, 173, 255}; // 進捗の色（紫）
+
+		// 垂直同期で読み込みが遅れないよう、表示は約60fpsに間引く（完了時は必ず表示）
+		const Uint64 time_current = SDL_GetTicks64();
+		if (progress < 1 && time_current - time_last_render_loading < 16)
+			return;
+		time_last_render_loading = time_current;
+
+		SDL_PumpEvents(); // ウィンドウが応答なしにならないようにイベントを処理
+
+		int width_screen, height_screen;
+		SDL_GetWindowSizeInPixels(window, &width_screen, &height_screen);
+		SDL_Rect rect_bar = {(width_screen - width_bar) / 2, (height_screen - height_bar) / 2, width_bar, height_bar};
+
+		SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+		SDL_RenderClear(renderer);
+		SDL_SetRenderDrawColor(renderer, color_background.r, color_background.g, color_background.b, color_background.a);
+		SDL_RenderFillRect(renderer, &rect_bar);
+		rect_bar.w = (int)(width_bar * std::min(progress, 1.0));
+		SDL_SetRenderDrawColor(renderer, color_foreground.r, color_foreground.g, color_foreground.b, color_foreground.a);
+		SDL_RenderFillRect(renderer, &rect_bar);
+		SDL_RenderPresent(renderer);
+	}
+
 	// タイルマップテクスチャの生成
 	bool generate_tile_map_texture()
 	{
@@ -320,10 +792,9 @@ private:
 		// タイルセットテクスチャの1行あたりのタイル数を計算
 		int num_tile_single_line = (int)std::ceil((double)width_tex_tile_set / SIZE_TILE);
 
-		// タイルマップテクスチャの幅と高さを計算（ピクセル単位）
-		int width_tex_tile_map, height_tex_tile_map;
-		width_tex_tile_map = (int)map.get_width() * SIZE_TILE;
-		height_tex_tile_map = (int)map.get_height() * SIZE_TILE;
+		// タイルマップをウィンドウ中央に配置し、テクスチャの幅と高さを取得（ピクセル単位）
+		ConfigManager::instance()->update_rect_tile_map();
+		int width_tex_tile_map = rect_tile_map.w, height_tex_tile_map = rect_tile_map.h;
 
 		// タイルマップのテクスチャを作成
 		tex_tile_map = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888,
@@ -331,13 +802,6 @@ private:
 		if (!tex_tile_map)
 			return false;
 
-		// タイルマップをウィンドウ中央に配置
-		ConfigManager *config = ConfigManager::instance();
-		rect_tile_map.x = (config->basic_template.window_width - width_tex_tile_map) / 2;
-		rect_tile_map.y = (config->basic_template.window_height - height_tex_tile_map) / 2;
-		rect_tile_map.w = width_tex_tile_map;
-		rect_tile_map.h = height_tex_tile_map;
-
 		// テクスチャのブレンドモードを設定
 		SDL_SetTextureBlendMode(tex_tile_map, SDL_BLENDMODE_BLEND);
 
@@ -350,7 +814,7 @@ private:
 			for (int x = 0; x < map.get_width(); x++)
 			{
 				SDL_Rect rect_src;
-				const Tile &tile = tile_map[y][x];
+				const Tile &tile = tile_map.get_tile(x, y);
 
 				// 現在のタイルの描画位置を計算
 				const SDL_Rect &rect_dst =
@@ -396,16 +860,16 @@ private:
 	// プレイヤーが選択したタイルがホームタイルかどうかをチェック
 	bool check_home(const SDL_Point &idx_tile_selected)
 	{
-		static const Map &map = ConfigManager::instance()->map;
-		static const SDL_Point &idx_home = map.get_idx_home();
+		const Map &map = ConfigManager::instance()->map;
+		const SDL_Point &idx_home = map.get_idx_home();
 		return (idx_home.x == idx_tile_selected.x && idx_home.y == idx_tile_selected.y);
 	}
 
 	// 画面上の座標からタイルのインデックスを取得
 	bool get_cursor_idx_tile(SDL_Point &idx_tile_selected, int screen_x, int screen_y) const
 	{
-		static const Map &map = ConfigManager::instance()->map;
-		static const SDL_Rect &rect_tile_map = ConfigManager::instance()->rect_tile_map;
+		const Map &map = ConfigManager::instance()->map;
+		const SDL_Rect &rect_tile_map = ConfigManager::instance()->rect_tile_map;
 
 		// マウス位置がタイルマップ領域外の場合はfalseを返す
 		if (screen_x < rect_tile_map.x || screen_x > rect_tile_map.x + rect_tile_map.w || screen_y < rect_tile_map.y || screen_y > rect_tile_map.y + rect_tile_map.h)
@@ -422,17 +886,17 @@ private:
 	bool can_place_tower(const SDL_Point &idx_tile_selected) const
 	{
 
-		static const Map &map = ConfigManager::instance()->map;
-		const Tile &tile = map.get_tile_map()[idx_tile_selected.y][idx_tile_selected.x];
+		const Map &map = ConfigManager::instance()->map;
+		const Tile &tile = map.get_tile_map().get_tile(idx_tile_selected.x, idx_tile_selected.y);
 
 		// タイルに装飾がなく、方向制限がなく、防御塔がない場合にtrueを返す
-		return (tile.decoration < 0 && tile.direction == Tile::Direction::None && !tile.has_tower);
+		return (tile.decoration < 0 && tile.direction == Tile::Direction::None && !map.check_tower(idx_tile_selected));
 	}
 
 	// プレイヤーが選択したタイルの中心位置を取得
 	void get_selected_tile_ceneter_pos(SDL_Point &pos, const SDL_Point &idx_tile_selected) const
 	{
-		static const SDL_Rect &rect_tile_map = ConfigManager::instance()->rect_tile_map;
+		const SDL_Rect &rect_tile_map = ConfigManager::instance()->rect_tile_map;
 
 		// 選択されたタイルの中心位置を計算
 		pos.x = rect_tile_map.x + idx_tile_selected.x * SIZE_TILE + SIZE_TILE / 2;
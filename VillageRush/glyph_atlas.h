@@ -0,0 +1,164 @@
+#ifndef _GLYPH_ATLAS_H_
+#define _GLYPH_ATLAS_H_
+
+/**
+ * @brief グリフアトラスクラス
+ *
+ * このクラスは、フォントの印字可能なASCII文字（グリフ）を初期化時に白色で1枚のテクスチャに書き込み、
+ * 文字列をグリフの矩形の並びとしてスプライトバッチに追加して描画します。
+ * 表示する文字列が毎フレーム変わっても、サーフェスの作成やテクスチャの転送は発生しません。
+ *
+ * 主な機能:
+ * - init() でフォントのグリフを格子状に並べたテクスチャを作成
+ * - draw_text() で文字列を指定した色で追加（頂点カラーで白色のグリフを着色）
+ * - draw_text_shadow() で影（オフセットした位置に影の色）と本体を続けて追加
+ * - get_text_width() / get_height() で文字列の描画サイズを取得
+ *
+ * 注意事項:
+ * - 文字ごとの送り幅は1文字ずつ描画した幅を使用するため、カーニングは適用されません
+ * - 印字可能なASCII文字以外は描画されません
+ * - 追加したテキストは SpriteBatchManager::flush() を呼び出すまで描画されないため、UIの層ごとに flush() すること
+ */
+
+#include "sprite_batch_manager.h"
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <algorithm>
+
+class GlyphAtlas
+{
+public:
+	GlyphAtlas() = default;
+	~GlyphAtlas() = default; // テクスチャは他のテクスチャと同じくレンダラーと共に解放される
+
+	GlyphAtlas(const GlyphAtlas &) = delete;
+	GlyphAtlas &operator=(const GlyphAtlas &) = delete;
+
+	// フォントのグリフを1枚のテクスチャに書き込む
+	bool init(SDL_Renderer *renderer, TTF_Font *font)
+	{
+		static const SDL_Color color_white = {255, 255, 255, 255};
+
+		// グリフごとに描画し、格子の1マスのサイズを求める
+		SDL_Surface *suf_glyph_list[num_glyph] = {nullptr};
+		int width_cell = 0;
+		for (int i = 0; i < num_glyph; i++)
+		{
+			const char str_glyph[2] = {(char)(first_glyph + i), '\0'};
+			suf_glyph_list[i] = TTF_RenderText_Blended(font, str_glyph, color_white);
+			if (!suf_glyph_list[i])
+				continue;
+
+			width_cell = std::max(width_cell, suf_glyph_list[i]->w);
+			height = std::max(height, suf_glyph_list[i]->h);
+		}
+
+		// アルファ値をそのまま書き込むため、ブレンドせずにコピー
+		SDL_Surface *suf_atlas = SDL_CreateRGBSurfaceWithFormat(0, (width_cell + padding) * num_column,
+																 (height + padding) * ((num_glyph + num_column - 1) / num_column), 32, SDL_PIXELFORMAT_RGBA32);
+		for (int i = 0; i < num_glyph; i++)
+		{
+			if (!suf_glyph_list[i])
+				continue;
+
+			Glyph &glyph = glyph_list[i];
+			glyph.rect_src = {(i % num_column) * (width_cell + padding), (i / num_column) * (height + padding), suf_glyph_list[i]->w, suf_glyph_list[i]->h};
+			glyph.advance = suf_glyph_list[i]->w;
+			if (suf_atlas)
+			{
+				SDL_SetSurfaceBlendMode(suf_glyph_list[i], SDL_BLENDMODE_NONE);
+				SDL_BlitSurface(suf_glyph_list[i], nullptr, suf_atlas, &glyph.rect_src);
+			}
+			SDL_FreeSurface(suf_glyph_list[i]);
+		}
+
+		if (!suf_atlas)
+			return false;
+
+		texture = SDL_CreateTextureFromSurface(renderer, suf_atlas);
+		SDL_FreeSurface(suf_atlas);
+		if (!texture)
+			return false;
+
+		SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+		return true;
+	}
+
+	// 文字列をスプライトバッチに追加（x, yは左上の位置）
+	void draw_text(int x, int y, const char *str, const SDL_Color &color) const
+	{
+		SpriteBatchManager *sprite_batch = SpriteBatchManager::instance();
+
+		if (!texture)
+			return;
+
+		SDL_Rect rect_dst = {x, y, 0, 0};
+		for (const char *c = str; *c; c++)
+		{
+			const Glyph *glyph = find_glyph(*c);
+			if (!glyph)
+				continue;
+
+			rect_dst.w = glyph->rect_src.w, rect_dst.h = glyph->rect_src.h;
+			sprite_batch->draw_tinted(texture, &glyph->rect_src, rect_dst, color);
+			rect_dst.x += glyph->advance;
+		}
+	}
+
+	// 影付きの文字列をスプライトバッチに追加（影を先に追加し、本体がその上に描画される）
+	void draw_text_shadow(int x, int y, const char *str, const SDL_Color &color_foreground,
+						  const SDL_Color &color_shadow, const SDL_Point &offset_shadow) const
+	{
+		draw_text(x + offset_shadow.x, y + offset_shadow.y, str, color_shadow);
+		draw_text(x, y, str, color_foreground);
+	}
+
+	// 文字列の描画幅
+	int get_text_width(const char *str) const
+	{
+		int width = 0;
+		for (const char *c = str; *c; c++)
+		{
+			const Glyph *glyph = find_glyph(*c);
+			if (glyph)
+				width += glyph->advance;
+		}
+		return width;
+	}
+
+	// 文字の高さ（すべてのグリフの最大値）
+	int get_height() const
+	{
+		return height;
+	}
+
+private:
+	static constexpr int first_glyph = 32; // 最初の文字（空白）
+	static constexpr int num_glyph = 95;   // 印字可能なASCII文字の数
+	static constexpr int num_column = 16;  // テクスチャ上の1行のグリフ数
+	static constexpr int padding = 1;	   // グリフ同士の余白
+
+	// グリフのテクスチャ上の矩形と送り幅
+	struct Glyph
+	{
+		SDL_Rect rect_src = {0, 0, 0, 0};
+		int advance = 0;
+	};
+
+private:
+	SDL_Texture *texture = nullptr;
+	Glyph glyph_list[num_glyph];
+	int height = 0;
+
+private:
+	const Glyph *find_glyph(char c) const
+	{
+		const int idx = c - first_glyph;
+		if (idx < 0 || idx >= num_glyph || glyph_list[idx].advance == 0)
+			return nullptr;
+		return &glyph_list[idx];
+	}
+};
+
+#endif // !_GLYPH_ATLAS_H_
@@ -6,13 +6,25 @@
 class GunnerTower : public Tower
 {
 public:
-	GunnerTower()
+	// アニメーションクリップは TowerManager が create_clip_set() で作成し、すべての砲手で共有する
+	GunnerTower(const ClipSet *clip_set)
 	{
+		set_clip_set(clip_set);
 
-		static SDL_Texture *tex_gunner = ResourcesManager::instance()
-											 ->get_texture_pool()
-											 .find(ResID::Tex_Gunner)
-											 ->second;
+		size.x = 48, size.y = 48;
+
+		tower_type = TowerType::Gunner;
+
+		fire_speed = 6;
+
+		bullet_type = BulletType::Shell;
+	};
+	~GunnerTower() = default;
+
+	// アニメーションクリップを作成（ゲームワールドごとに一度だけ TowerManager が呼び出す）
+	static ClipSet create_clip_set()
+	{
+		const TextureRegion region_gunner = ResourcesManager::instance()->find_region(ResID::Tex_Gunner);
 
 		static const std::vector<int> idx_list_idle_up = {4, 5};
 		static const std::vector<int> idx_list_idle_down = {0, 1};
@@ -24,25 +36,18 @@ public:
 		static const std::vector<int> idx_list_fire_left = {28, 29, 30, 31};
 		static const std::vector<int> idx_list_fire_right = {24, 25, 26, 27};
 
-		anim_idle_up.set_frame_data(tex_gunner, 4, 8, idx_list_idle_up);
-		anim_idle_down.set_frame_data(tex_gunner, 4, 8, idx_list_idle_down);
-		anim_idle_left.set_frame_data(tex_gunner, 4, 8, idx_list_idle_left);
-		anim_idle_right.set_frame_data(tex_gunner, 4, 8, idx_list_idle_right);
-
-		anim_fire_up.set_frame_data(tex_gunner, 4, 8, idx_list_fire_up);
-		anim_fire_down.set_frame_data(tex_gunner, 4, 8, idx_list_fire_down);
-		anim_fire_left.set_frame_data(tex_gunner, 4, 8, idx_list_fire_left);
-		anim_fire_right.set_frame_data(tex_gunner, 4, 8, idx_list_fire_right);
-
-		size.x = 48, size.y = 48;
-
-		tower_type = TowerType::Gunner;
-
-		fire_speed = 6;
-
-		bullet_type = BulletType::Shell;
-	};
-	~GunnerTower() = default;
+		ClipSet clip_set;
+		clip_set.idle_up.set_frame_data(region_gunner, 4, 8, idx_list_idle_up);
+		clip_set.idle_down.set_frame_data(region_gunner, 4, 8, idx_list_idle_down);
+		clip_set.idle_left.set_frame_data(region_gunner, 4, 8, idx_list_idle_left);
+		clip_set.idle_right.set_frame_data(region_gunner, 4, 8, idx_list_idle_right);
+
+		clip_set.fire_up.set_frame_data(region_gunner, 4, 8, idx_list_fire_up);
+		clip_set.fire_down.set_frame_data(region_gunner, 4, 8, idx_list_fire_down);
+		clip_set.fire_left.set_frame_data(region_gunner, 4, 8, idx_list_fire_left);
+		clip_set.fire_right.set_frame_data(region_gunner, 4, 8, idx_list_fire_right);
+		return clip_set;
+	}
 
 private:
 };
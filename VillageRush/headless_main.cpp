@@ -0,0 +1,17 @@
+#define SDL_MAIN_HANDLED
+#define ALLOC_COUNTER_IMPLEMENTATION // このファイルで operator new を置き換え、ヒープ確保回数を数える（デバッグビルドのみ）
+
+#include "game_manager.h"
+
+// ヘッドレスシミュレーションのエントリーポイント
+// ウィンドウ・レンダラー・オーディオを使用せずにレベルを最後まで実行し、結果を標準出力に表示する
+// トレース: 「--trace FILE [--trace-frames N]」で各処理の計測結果をChrome / Perfetto形式で出力する（デバッグビルドのみ）
+// リプレイ: 「--replay FILE」でウィンドウモードの「--record FILE」で記録した入力を再生する
+// ビルド例（Linux）:
+//   g++ -std=c++17 -O2 headless_main.cpp -o village_rush_headless $(sdl2-config --cflags --libs) -lSDL2_image -lSDL2_mixer -lSDL2_ttf -lSDL2_gfx -lcjson
+int main(int argc, char** argv)
+{
+	ConfigManager::instance()->is_headless = true;
+	GameManager::init_profile(argc, argv);
+	return GameManager::instance()->run(argc, argv);
+};
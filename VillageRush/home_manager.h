@@ -17,7 +17,7 @@ public:
 
 	void decrease_hp(double val)
 	{
-		static ConfigManager *config_manager = ConfigManager::instance();
+		ConfigManager *config_manager = ConfigManager::instance();
 		num_hp -= val;
 		if (num_hp < 0)
 		{
@@ -26,9 +26,9 @@ public:
 			config_manager->is_game_over = true;
 		}
 
-		static const ResourcesManager::SoundPool &sound_pool = ResourcesManager::instance()->get_sound_pool();
+		const ResourcesManager *resources_manager = ResourcesManager::instance();
 
-		Mix_PlayChannel(-1, sound_pool.find(ResID::Sound_HomeHurt)->second, 0);
+		resources_manager->play_sound(ResID::Sound_HomeHurt);
 	}
 
 protected:
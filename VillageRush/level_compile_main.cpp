@@ -0,0 +1,72 @@
+#define SDL_MAIN_HANDLED
+
+#include "compiled_level.h"
+
+#include <string>
+#include <iostream>
+
+// レベルコンパイルツールのエントリーポイント
+// map.csv・level.json・config.json を解析し、進行ルートを探索した結果をコンパイル済みレベルとして保存する
+// （ゲームは起動時に level.bin があればテキスト形式のファイルの代わりに読み込む）
+// 使用例: village_rush_level_compile [--map FILE] [--level FILE] [--config FILE] [--out FILE]（VillageRush ディレクトリで実行）
+// ビルド例（Linux）:
+//   g++ -std=c++17 -O2 level_compile_main.cpp -o village_rush_level_compile $(sdl2-config --cflags --libs) -lcjson
+int main(int argc, char** argv)
+{
+	std::string path_map = "map.csv", path_level = "level.json", path_config = "config.json", path_out = "level.bin";
+	bool is_valid_args = true;
+
+	// コマンドライン引数の解析
+	for (int i = 1; i < argc; i++)
+	{
+		const std::string arg = argv[i];
+		if (arg == "--map" && i + 1 < argc)
+			path_map = argv[++i];
+		else if (arg == "--level" && i + 1 < argc)
+			path_level = argv[++i];
+		else if (arg == "--config" && i + 1 < argc)
+			path_config = argv[++i];
+		else if (arg == "--out" && i + 1 < argc)
+			path_out = argv[++i];
+		else
+			is_valid_args = false;
+	}
+	if (!is_valid_args)
+	{
+		std::cerr << "usage: " << argv[0] << " [--map FILE] [--level FILE] [--config FILE] [--out FILE]" << std::endl;
+		return -1;
+	}
+
+	// ゲームと同じ手順でテキスト形式のファイルを読み込む
+	// （レベル設定の敵の名前を敵の種類に変換するため、ゲーム設定を先に読み込む）
+	ConfigManager *config = ConfigManager::instance();
+	config->is_headless = true; // 読み込みのエラーをメッセージボックスではなく標準エラー出力に表示
+	if (!config->map.load(path_map))
+	{
+		std::cerr << u8"ゲームマップの読み込みに失敗しました: " << path_map << std::endl;
+		return -1;
+	}
+	if (!config->load_game_config(path_config))
+	{
+		std::cerr << u8"ゲーム設定の読み込みに失敗しました: " << path_config << std::endl;
+		return -1;
+	}
+	if (!config->load_level_config(path_level))
+	{
+		std::cerr << u8"レベル設定の読み込みに失敗しました: " << path_level << std::endl;
+		return -1;
+	}
+
+	CompiledLevel::SourceList source_list;
+	source_list.path_map = path_map, source_list.path_config = path_config, source_list.path_level = path_level;
+	if (!CompiledLevel::compile(path_out, *config, source_list))
+	{
+		std::cerr << u8"コンパイル済みレベルの保存に失敗しました: " << path_out << std::endl;
+		return -1;
+	}
+
+	std::cout << config->map.get_width() << "x" << config->map.get_height() << " tiles, "
+			  << config->map.get_spawner_route_pool().size() << " routes, "
+			  << config->wave_list.size() << " waves -> " << path_out << std::endl;
+	return 0;
+};
@@ -1,8 +1,10 @@
 #define SDL_MAIN_HANDLED
+#define ALLOC_COUNTER_IMPLEMENTATION // このファイルで operator new を置き換え、ヒープ確保回数を数える（デバッグビルドのみ）
 
 #include "game_manager.h"
 
 int main(int argc, char** argv)
 {
+	GameManager::init_profile(argc, argv);
 	return GameManager::instance()->run(argc, argv);
 };
\ No newline at end of file
@@ -13,8 +13,18 @@ public:
 		return manager;
 	}
 
+	// マネージャーインスタンスを破棄（次回のinstance()呼び出しで新たに作成される）
+	// 破棄後も使用されないよう、インスタンスやそのデータへのポインタを関数内の静的変数（static thread_local）に保持しないこと
+	// （必要な場合は使用するたびに instance() から取得するか、マネージャーのメンバーとして保持する）
+	static void destroy()
+	{
+		delete manager;
+		manager = nullptr;
+	}
+
 private:
-	static T *manager;
+	// スレッドごとに独立したインスタンスを持ち、複数のゲームワールドを並列に実行できるようにする
+	static thread_local T *manager;
 
 protected:
 	Manager() = default;
@@ -23,6 +33,6 @@ protected:
 	Manager &operator=(const Manager &) = delete;
 };
 template <typename T>
-T *Manager<T>::manager = nullptr;
+thread_local T *Manager<T>::manager = nullptr;
 
 #endif // !_MANAGER_H
@@ -3,11 +3,15 @@
 
 #include "tile.h"
 #include "route.h"
+#include "archive_manager.h"
 
 #include <SDL.h>
 #include <string>
 #include <fstream>
 #include <sstream>
+#include <utility>
+#include <cstdint>
+#include <algorithm>
 #include <unordered_map>
 
 class Map
@@ -22,14 +26,15 @@ public:
 	// 指定されたパスからマップを読み込む
 	bool load(const std::string &path)
 	{
-		std::ifstream file(path); // ファイルを開くためのifstream
+		AssetStream file(path); // ファイル（アーカイブがある場合はアーカイブ内のファイル）を開くためのストリーム
 		if (!file.good())
 			return false;
 
 		// 補助変数の初期化
-		TileMap tile_map_temp;		// マップを一時的に保存
-		int idx_x = -1, idx_y = -1; // マップの列と行を記録
-		std::string str_line;		// ファイルから読み取った各行のデータを保存
+		std::vector<Tile> tile_list; // 行優先でタイルを一時的に保存
+		size_t width_map = 0;		 // マップの幅（最初の行の列数）
+		size_t height_map = 0;		 // マップの行数
+		std::string str_line;		 // ファイルから読み取った各行のデータを保存
 
 		// ファイルを1行ずつ読み取る
 		while (std::getline(file, str_line))
@@ -38,28 +43,36 @@ public:
 			if (str_line.empty())
 				continue;
 
-			// 空でない行を読み取るたびに、行番号を増やし、マップ全体に新しい行を追加
-			idx_x = -1, idx_y++;
-			tile_map_temp.emplace_back();
+			// 空でない行を読み取るたびに、行数を増やす
+			height_map++;
+			size_t idx_x = 0; // 現在の行で読み取った列数
 
 			std::string str_tile;
 			std::stringstream str_stream(str_line);
 			while (std::getline(str_stream, str_tile, ',')) // str_streamの値を1つずつ読み取り、「,」で分割し、str_tileに保存
 			{
-				// タイルデータを1つ読み取るたびに:
-				idx_x++;								  // 列番号を増やす
-				tile_map_temp[idx_y].emplace_back();	  // 新しい列を追加
-				Tile &tile = tile_map_temp[idx_y].back(); // 現在の行のTileを取得
-				load_tile_from_string(tile, str_tile);
+				// 最初の行より長い行の余分な列は無視する
+				if (height_map > 1 && idx_x >= width_map)
+					break;
+
+				tile_list.emplace_back();
+				load_tile_from_string(tile_list.back(), str_tile);
+				idx_x++;
 			}
+
+			// 最初の行の列数をマップの幅とし、短い行は既定のタイルで埋める
+			if (height_map == 1)
+				width_map = idx_x;
+			tile_list.resize(height_map * width_map);
 		}
 		file.close();
 
-		if (tile_map_temp.empty() || tile_map_temp[0].empty())
+		if (width_map == 0 || height_map == 0)
 		{
 			return false;
 		}
-		tile_map = tile_map_temp;
+		tile_map = TileMap(width_map, height_map, std::move(tile_list));
+		reset_tower_bitmap();
 
 		generate_map_cache();
 
@@ -69,15 +82,13 @@ public:
 	// マップの幅を取得
 	size_t get_width() const
 	{
-		if (tile_map.empty())
-			return 0;
-		return tile_map[0].size();
+		return tile_map.get_width();
 	}
 
 	// マップの高さを取得
 	size_t get_height() const
 	{
-		return tile_map.size();
+		return tile_map.get_height();
 	}
 
 	// マップ全体の情報を取得
@@ -98,18 +109,49 @@ public:
 		return spawner_route_pool;
 	}
 
+	// 読み込み済みのタイル・防御ポイント・進行ルートを設定（コンパイル済みレベルから読み込む場合、ルートは探索しない）
+	void set_data(TileMap &&tile_map, const SDL_Point &idx_home, SpawnerRoutePool &&spawner_route_pool)
+	{
+		this->tile_map = std::move(tile_map);
+		this->idx_home = idx_home;
+		this->spawner_route_pool = std::move(spawner_route_pool);
+		reset_tower_bitmap();
+	}
+
 	// 防御タワーを設置
 	void place_tower(const SDL_Point &idx_tile)
 	{
-		tile_map[idx_tile.y][idx_tile.x].has_tower = true;
+		const size_t idx = get_idx_bitmap(idx_tile);
+		tower_bitmap[idx / 64] |= (uint64_t)1 << (idx % 64);
+	}
+
+	// 指定したタイルに防御タワーが設置されているかどうか
+	bool check_tower(const SDL_Point &idx_tile) const
+	{
+		const size_t idx = get_idx_bitmap(idx_tile);
+		return (tower_bitmap[idx / 64] >> (idx % 64)) & 1;
 	}
 
 private:
 	TileMap tile_map;
 	SDL_Point idx_home = {0};
 	SpawnerRoutePool spawner_route_pool;
+	std::vector<uint64_t> tower_bitmap; // 防御タワーの設置状況（1タイル1ビット、行優先）
 
 private:
+	// すべてのタイルを防御タワーが設置されていない状態にする
+	void reset_tower_bitmap()
+	{
+		tower_bitmap.assign((get_width() * get_height() + 63) / 64, 0);
+	}
+
+	static constexpr int max_direction = 15; // 方向マーカーのビット数（4ビット）で表せる最大値
+
+	size_t get_idx_bitmap(const SDL_Point &idx_tile) const
+	{
+		return (size_t)idx_tile.y * get_width() + idx_tile.x;
+	}
+
 	// 文字列の両端の空白を削除するために使用
 	std::string trim_str(const std::string &str)
 	{
@@ -149,11 +191,11 @@ private:
 			values.push_back(value); // 整数値を解析するたびに、valuesにプッシュ
 		}
 
-		// 解析された値を割り当てる
-		tile.terrian = (values.size() < 1 || values[0] < 0) ? 0 : values[0];
-		tile.decoration = (values.size() < 2) ? -1 : values[1];
-		tile.direction = (Tile::Direction)((values.size() < 3 || values[2] < 0) ? 0 : values[2]);
-		tile.special_flag = (values.size() <= 3) ? -1 : values[3];
+		// 解析された値を割り当てる（Tileのフィールドの範囲外の値は指定がないものとみなす）
+		tile.terrian = (values.size() < 1 || values[0] < 0 || values[0] > UINT16_MAX) ? 0 : (uint16_t)values[0];
+		tile.decoration = (values.size() < 2 || values[1] > INT16_MAX) ? -1 : (int16_t)std::max(values[1], -1);
+		tile.direction = (Tile::Direction)((values.size() < 3 || values[2] < 0 || values[2] > max_direction) ? 0 : values[2]);
+		tile.special_flag = (values.size() <= 3 || values[3] > Tile::max_special_flag) ? -1 : std::max(values[3], -1);
 	}
 
 	void generate_map_cache()
@@ -163,7 +205,7 @@ private:
 		{
 			for (int x = 0; x < get_width(); x++)
 			{
-				const Tile &tile = tile_map[y][x];
+				const Tile &tile = tile_map.get_tile(x, y);
 				if (tile.special_flag < 0) // 特殊フラグがない場合はスキップ
 					continue;
 
@@ -0,0 +1,97 @@
+#ifndef _OBJECT_POOL_H_
+#define _OBJECT_POOL_H_
+
+/**
+ * @brief オブジェクトプールクラス
+ *
+ * このクラスは、同じ型のオブジェクトをまとめて確保し、使い終わったオブジェクトを再利用するためのプールです。
+ * 弾丸・敵・コインプロップのように頻繁に生成と削除を繰り返すオブジェクトのヒープ確保を、
+ * プールが足りなくなった場合だけに抑えます。
+ *
+ * 主な機能:
+ * - acquire() で空きオブジェクトを取り出し、release() で返却
+ * - 空きがない場合は、現在の総数と同じ数（最低 min_num_chunk 個）のオブジェクトを一度に確保
+ * - ブロックの確保回数と、確保済み・使用中のオブジェクト数の取得（プロファイラへの出力用）
+ *
+ * 注意事項:
+ * - 確保回数はプール自体のブロックの確保のみを数えます（毎刻みのすべてのヒープ確保の回数は AllocCounter で計測します）
+ * - オブジェクトは確保したブロック内から移動しないため、ポインタは返却されるまで有効です
+ * - 取り出したオブジェクトは前回使用時の状態が残っているため、呼び出し側で初期化し直す必要があります
+ * - オブジェクトはプールの破棄時にまとめて解放されるため、delete しないこと
+ */
+
+#include <memory>
+#include <vector>
+#include <algorithm>
+
+template <typename T>
+class ObjectPool
+{
+public:
+	ObjectPool() = default;
+	~ObjectPool() = default;
+
+	ObjectPool(const ObjectPool &) = delete;
+	ObjectPool &operator=(const ObjectPool &) = delete;
+
+	// 空きオブジェクトを取り出す（空きがない場合のみ新しいブロックを確保）
+	T *acquire()
+	{
+		if (free_list.empty())
+			grow();
+
+		T *object = free_list.back();
+		free_list.pop_back();
+		return object;
+	}
+
+	// オブジェクトを返却し、次の acquire() で再利用できるようにする
+	void release(T *object)
+	{
+		free_list.push_back(object);
+	}
+
+	// これまでのブロックの確保回数（プール以外のヒープ確保は含まない）
+	size_t get_num_chunk_alloc() const
+	{
+		return chunk_list.size();
+	}
+
+	// 確保済みのオブジェクト数
+	size_t get_num_object() const
+	{
+		return num_object;
+	}
+
+	// 使用中のオブジェクト数
+	size_t get_num_active() const
+	{
+		return num_object - free_list.size();
+	}
+
+private:
+	static constexpr size_t min_num_chunk = 64; // 一度に確保するオブジェクト数の最小値
+
+private:
+	std::vector<std::unique_ptr<T[]>> chunk_list; // 確保したブロックのリスト
+	std::vector<T *> free_list;					  // 空きオブジェクトのリスト
+	size_t num_object = 0;
+
+private:
+	void grow()
+	{
+		const size_t num_chunk = std::max(min_num_chunk, num_object);
+		chunk_list.emplace_back(new T[num_chunk]);
+		num_object += num_chunk;
+
+		// すべてのオブジェクトが返却されても release() で再確保が起きないよう、先に容量を確保
+		free_list.reserve(num_object);
+
+		// ブロックの先頭から順に取り出されるよう、末尾から積む
+		T *chunk = chunk_list.back().get();
+		for (size_t i = num_chunk; i > 0; i--)
+			free_list.push_back(&chunk[i - 1]);
+	}
+};
+
+#endif // !_OBJECT_POOL_H_
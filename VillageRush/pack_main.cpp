@@ -0,0 +1,80 @@
+#define SDL_MAIN_HANDLED
+
+#include "archive_manager.h"
+#include "compiled_level.h"
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+#include <filesystem>
+
+// アセットアーカイブ作成ツールのエントリーポイント
+// ゲームが読み込むファイルを1つのアーカイブにまとめる（ゲームは起動時に resources.pak があればアーカイブから読み込む）
+// ファイルを指定しない場合は、map.csv・level.json・config.json（コンパイル済みの level.bin があり、
+// 元のファイルがコンパイル後に変更されていなければそれも）と resources ディレクトリ直下のすべてのファイルをまとめる
+// 使用例: village_rush_pack --out resources.pak [FILE ...]（VillageRush ディレクトリで実行し、パスはゲームと同じ相対パスで指定）
+// ビルド例（Linux）:
+//   g++ -std=c++17 -O2 pack_main.cpp -o village_rush_pack $(sdl2-config --cflags --libs) -lcjson
+int main(int argc, char** argv)
+{
+	std::string path_out = "resources.pak";
+	std::vector<std::string> path_list;
+	bool is_valid_args = true;
+
+	// コマンドライン引数の解析
+	for (int i = 1; i < argc; i++)
+	{
+		const std::string arg = argv[i];
+		if (arg == "--out" && i + 1 < argc)
+			path_out = argv[++i];
+		else if (arg.rfind("--", 0) != 0)
+			path_list.push_back(arg);
+		else
+			is_valid_args = false;
+	}
+	if (!is_valid_args)
+	{
+		std::cerr << "usage: " << argv[0] << " [--out FILE] [FILE ...]" << std::endl;
+		return -1;
+	}
+
+	// 既定のファイルのリスト（アトラスのキャッシュなどのサブディレクトリは含めない）
+	if (path_list.empty())
+	{
+		path_list = {"map.csv", "level.json", "config.json"};
+		if (std::filesystem::is_regular_file("level.bin"))
+		{
+			if (CompiledLevel::check_source("level.bin"))
+				path_list.push_back("level.bin");
+			else
+				std::cerr << u8"level.bin は元のファイルの変更前にコンパイルされたため含めません（レベルコンパイルツールでコンパイルし直してください）" << std::endl;
+		}
+
+		std::vector<std::string> path_resource_list;
+		std::error_code error;
+		for (const auto &item : std::filesystem::directory_iterator("resources", error))
+		{
+			if (item.is_regular_file())
+				path_resource_list.push_back("resources/" + item.path().filename().string());
+		}
+		if (error)
+		{
+			std::cerr << u8"resources ディレクトリを読み込めません" << std::endl;
+			return -1;
+		}
+
+		// 同じファイルからは同じアーカイブが作成されるよう、パスの順に並べる
+		std::sort(path_resource_list.begin(), path_resource_list.end());
+		path_list.insert(path_list.end(), path_resource_list.begin(), path_resource_list.end());
+	}
+
+	if (!ArchiveManager::pack(path_out, path_list))
+	{
+		std::cerr << u8"アーカイブの作成に失敗しました: " << path_out << std::endl;
+		return -1;
+	}
+
+	std::cout << path_list.size() << " files -> " << path_out << std::endl;
+	return 0;
+};
@@ -2,10 +2,11 @@
 #define _PANEL_H_
 
 #include "resources_manager.h"
+#include "sprite_batch_manager.h"
 #include "tile.h"
 
 #include <SDL.h>
-#include <string>
+#include <cstdio>
 
 class Panel
 {
@@ -13,14 +14,10 @@ public:
 	Panel()
 	{
 		// 選択カーソルのテクスチャを初期化
-		tex_select_cursor = ResourcesManager::instance()->get_texture_pool().find(ResID::Tex_UISelectCursor)->second;
+		tex_select_cursor = ResourcesManager::instance()->find_texture(ResID::Tex_UISelectCursor);
 	}
 
-	~Panel()
-	{
-		SDL_DestroyTexture(tex_text_background);
-		SDL_DestroyTexture(tex_text_foreground);
-	}
+	virtual ~Panel() = default;
 
 	// パネルを表示
 	void show()
@@ -114,9 +111,6 @@ public:
 	// パネルの状態を更新
 	virtual void on_update(SDL_Renderer *renderer)
 	{
-		// リソースマネージャーからフォントリソースを取得
-		static TTF_Font *font = ResourcesManager::instance()->get_font_pool().find(ResID::Font_Main)->second;
-
 		// ホバーターゲットがない場合は更新不要
 		if (hover_target == HoveredTarget::None)
 			return;
@@ -136,25 +130,11 @@ public:
 			break;
 		}
 
-		// 古いテクスチャリソースを破棄
-		SDL_DestroyTexture(tex_text_background);
-		tex_text_background = nullptr;
-		SDL_DestroyTexture(tex_text_foreground);
-		tex_text_foreground = nullptr;
-
-		// ホバーターゲットの値に基づいてテキストテクスチャを生成
-		std::string str_val = val < 0 ? "MAX" : std::to_string(val);
-		SDL_Surface *suf_text_background = TTF_RenderText_Blended(font, str_val.c_str(), color_text_background);
-		SDL_Surface *suf_text_foreground = TTF_RenderText_Blended(font, str_val.c_str(), color_text_foreground);
-
-		// テクスチャを作成し、テキストの幅と高さを取得
-		width_text = suf_text_background->w, height_text = suf_text_background->h;
-		tex_text_background = SDL_CreateTextureFromSurface(renderer, suf_text_background);
-		tex_text_foreground = SDL_CreateTextureFromSurface(renderer, suf_text_foreground);
-
-		// サーフェスリソースを解放
-		SDL_FreeSurface(suf_text_background);
-		SDL_FreeSurface(suf_text_foreground);
+		// ホバーターゲットの値に基づいてテキストを更新（描画時にグリフアトラスから組み立てる）
+		if (val < 0)
+			snprintf(str_text, sizeof(str_text), "MAX");
+		else
+			snprintf(str_text, sizeof(str_text), "%d", val);
 	}
 
 	// パネルをレンダリング
@@ -196,19 +176,14 @@ public:
 		}
 		SDL_RenderCopy(renderer, tex_panel, nullptr, &rect_dst_panel);
 
-		// 背景をレンダリング（ホバーターゲットが存在する場合）
+		// 影付きのテキストをレンダリング（ホバーターゲットが存在する場合）
 		if (hover_target == HoveredTarget::None)
 			return;
-		SDL_Rect rect_dst_text;
-		rect_dst_text.x = center_pos.x - width_text / 2 + offset_shadow.x;
-		rect_dst_text.y = center_pos.y + height / 2 + offset_shadow.y;
-		rect_dst_text.w = width_text, rect_dst_text.h = height_text;
-		SDL_RenderCopy(renderer, tex_text_background, nullptr, &rect_dst_text);
-
-		// 前景テキストをレンダリング
-		rect_dst_text.x -= offset_shadow.x;
-		rect_dst_text.y -= offset_shadow.y;
-		SDL_RenderCopy(renderer, tex_text_foreground, nullptr, &rect_dst_text);
+		const GlyphAtlas *glyph_atlas = ResourcesManager::instance()->find_glyph_atlas(ResID::Font_Main);
+		SpriteBatchManager *sprite_batch = SpriteBatchManager::instance();
+		glyph_atlas->draw_text_shadow(center_pos.x - glyph_atlas->get_text_width(str_text) / 2, center_pos.y + height / 2,
+									  str_text, color_text_foreground, color_text_background, offset_shadow);
+		sprite_batch->flush(renderer);
 	}
 
 protected:
@@ -253,10 +228,8 @@ private:
 	const SDL_Color color_text_background = {175, 175, 175, 255};
 	const SDL_Color color_text_foreground = {255, 255, 255, 255};
 
-	// テキストの幅と高さ、およびテクスチャリソース
-	int width_text = 0, height_text = 0;
-	SDL_Texture *tex_text_background = nullptr;
-	SDL_Texture *tex_text_foreground = nullptr;
+	// ホバーターゲットの値のテキスト
+	char str_text[16] = "";
 };
 
 #endif // !_PANEL_H_
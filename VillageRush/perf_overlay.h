@@ -0,0 +1,176 @@
+#ifndef _PERF_OVERLAY_H_
+#define _PERF_OVERLAY_H_
+
+/**
+ * @brief パフォーマンスオーバーレイクラス
+ *
+ * このクラスは、フレーム時間とエンティティ数を画面上に表示するデバッグ用のオーバーレイです。
+ *
+ * 主な機能:
+ * - フレーム時間と、更新・描画・表示（垂直同期待ち）の内訳の表示
+ * - 直近5秒間のフレーム時間のグラフと、最小・平均・最大値の表示
+ * - 敵・弾・防御塔・コインプロップの数と、使用中のオーディオチャンネル数の表示
+ *
+ * 毎フレームのメモリ確保を避けるため、文字は ResourcesManager のグリフアトラス（小さいフォント）から組み立てて描画し、
+ * 履歴とグラフの頂点は固定長の配列に保存します。
+ */
+
+#include "resources_manager.h"
+#include "enemy_manager.h"
+#include "bullet_manager.h"
+#include "tower_manager.h"
+#include "coin_manager.h"
+#include "sprite_batch_manager.h"
+
+#include <SDL.h>
+#include <cstdio>
+#include <algorithm>
+#include <SDL_mixer.h>
+#include <SDL2_gfxPrimitives.h>
+
+class PerfOverlay
+{
+public:
+	PerfOverlay() = default;
+	~PerfOverlay() = default;
+
+	// テキストの描画に使用するグリフアトラスの取得
+	void init(SDL_Renderer *renderer)
+	{
+		glyph_atlas = ResourcesManager::instance()->find_glyph_atlas(ResID::Font_Small);
+		height_glyph = glyph_atlas ? glyph_atlas->get_height() : 0;
+	}
+
+	// 表示・非表示の切り替え
+	void toggle()
+	{
+		visible = !visible;
+	}
+
+	// 1フレーム分の計測結果を記録（単位は秒）
+	void on_frame(double time_frame, double time_update, double time_render, double time_present)
+	{
+		idx_sample_newest = (idx_sample_newest + 1) % max_num_sample;
+		num_sample = std::min(num_sample + 1, max_num_sample);
+
+		Sample &sample = sample_list[idx_sample_newest];
+		sample.time_frame = time_frame;
+		sample.time_update = time_update;
+		sample.time_render = time_render;
+		sample.time_present = time_present;
+	}
+
+	void on_render(SDL_Renderer *renderer)
+	{
+		if (!visible || num_sample == 0)
+			return;
+
+		// 直近の履歴期間内のサンプルを新しい順に集計し、グラフの頂点を作成
+		double time_min = 1e9, time_max = 0, time_sum = 0;
+		int num_point = 0;
+		for (int i = 0; i < num_sample && time_sum < duration_history; i++)
+		{
+			const Sample &sample = sample_list[(idx_sample_newest - i + max_num_sample) % max_num_sample];
+			time_min = std::min(time_min, sample.time_frame);
+			time_max = std::max(time_max, sample.time_frame);
+			time_sum += sample.time_frame;
+
+			// 右端が最新、左端が履歴期間の始まり
+			point_list[num_point].x = position.x + padding + width_graph - (int)(std::min(time_sum / duration_history, 1.0) * width_graph);
+			point_list[num_point].y = position.y + height_panel - padding - (int)(std::min(sample.time_frame / time_graph_top, 1.0) * height_graph);
+			num_point++;
+		}
+
+		// 背景
+		boxRGBA(renderer, position.x, position.y, position.x + width_panel, position.y + height_panel,
+				color_background.r, color_background.g, color_background.b, color_background.a);
+
+		// テキスト
+		const Sample &sample = sample_list[idx_sample_newest];
+		char str_line[128];
+		int y = position.y + padding;
+
+		snprintf(str_line, sizeof(str_line), "frame %.2f ms  min %.2f avg %.2f max %.2f",
+				 sample.time_frame * 1000, time_min * 1000, time_sum / num_point * 1000, time_max * 1000);
+		render_text(renderer, position.x + padding, y, str_line, sample.time_frame > time_budget ? color_over_budget : color_text);
+		y += height_glyph;
+
+		snprintf(str_line, sizeof(str_line), "update %.2f  render %.2f  present %.2f ms",
+				 sample.time_update * 1000, sample.time_render * 1000, sample.time_present * 1000);
+		render_text(renderer, position.x + padding, y, str_line, color_text);
+		y += height_glyph;
+
+		snprintf(str_line, sizeof(str_line), "enemy %d  bullet %d  tower %d  coin %d  audio %d/%d",
+				 (int)EnemyManager::instance()->get_enemy_list().size(), (int)BulletManager::instance()->get_bullet_list().size(),
+				 (int)TowerManager::instance()->get_tower_list().size(), (int)CoinManager::instance()->get_coin_prop_list().size(),
+				 Mix_Playing(-1), Mix_AllocateChannels(-1));
+		render_text(renderer, position.x + padding, y, str_line, color_text);
+		SpriteBatchManager::instance()->flush(renderer);
+
+		// グラフの枠と予算ライン（1刻み分の時間）
+		const int x_graph = position.x + padding, y_graph_bottom = position.y + height_panel - padding;
+		rectangleRGBA(renderer, x_graph, y_graph_bottom - height_graph, x_graph + width_graph, y_graph_bottom,
+					  color_text.r, color_text.g, color_text.b, 96);
+		const int y_budget = y_graph_bottom - (int)(time_budget / time_graph_top * height_graph);
+		hlineRGBA(renderer, x_graph, x_graph + width_graph, y_budget,
+				  color_over_budget.r, color_over_budget.g, color_over_budget.b, 160);
+
+		// フレーム時間のグラフ
+		SDL_SetRenderDrawColor(renderer, color_graph.r, color_graph.g, color_graph.b, color_graph.a);
+		SDL_RenderDrawLines(renderer, point_list, num_point);
+	}
+
+	// 予算となるフレーム時間（秒）
+	void set_time_budget(double val)
+	{
+		time_budget = val;
+	}
+
+private:
+	// 1フレーム分の計測結果（秒）
+	struct Sample
+	{
+		double time_frame = 0;
+		double time_update = 0;
+		double time_render = 0;
+		double time_present = 0;
+	};
+
+private:
+	static constexpr int max_num_sample = 1200; // 保存するサンプル数の上限（240fpsで5秒分）
+
+	const double duration_history = 5;				 // 履歴の表示期間（秒）
+	const SDL_Point position = {15, 170};			 // オーバーレイの位置（ステータスバーの下）
+	const int width_panel = 380, height_panel = 150; // オーバーレイのサイズ
+	const int padding = 6;							 // 内側の余白
+	const int width_graph = 368, height_graph = 80;	 // グラフのサイズ
+	const double time_graph_top = 1.0 / 30;			 // グラフ上端のフレーム時間（秒）
+
+	const SDL_Color color_background = {0, 0, 0, 160};	  // 背景の色（半透明の黒）
+	const SDL_Color color_text = {255, 255, 255, 255};	  // テキストの色（白）
+	const SDL_Color color_over_budget = {255, 96, 96, 255}; // 予算超過の色（赤）
+	const SDL_Color color_graph = {120, 220, 120, 255};	  // グラフの色（緑）
+
+private:
+	bool visible = false;
+	double time_budget = 1.0 / 60;
+
+	const GlyphAtlas *glyph_atlas = nullptr;
+	int height_glyph = 0;
+
+	Sample sample_list[max_num_sample];
+	int idx_sample_newest = max_num_sample - 1;
+	int num_sample = 0;
+
+	SDL_Point point_list[max_num_sample];
+
+private:
+	// テキストをスプライトバッチに追加（呼び出し側で flush() する）
+	void render_text(SDL_Renderer *renderer, int x, int y, const char *str, const SDL_Color &color)
+	{
+		if (glyph_atlas)
+			glyph_atlas->draw_text(x, y, str, color);
+	}
+};
+
+#endif // !_PERF_OVERLAY_H_
@@ -6,8 +6,7 @@
 #include "coin_manager.h"
 #include "tower_manager.h"
 #include "resources_manager.h"
-
-#include <SDL2_gfxPrimitives.h>
+#include "primitive_cache_manager.h"
 
 class PlacePanel : public Panel
 {
@@ -15,13 +14,13 @@ public:
 	PlacePanel()
 	{
 		// リソースマネージャーのテクスチャプールを取得
-		const ResourcesManager::TexturePool &texture_pool = ResourcesManager::instance()->get_texture_pool();
+		const ResourcesManager *resources_manager = ResourcesManager::instance();
 
 		// テクスチャプールから異なる状態のテクスチャリソースを取得
-		tex_idle = texture_pool.find(ResID::Tex_UIPlaceIdle)->second;
-		tex_hovered_top = texture_pool.find(ResID::Tex_UIPlaceHoveredTop)->second;
-		tex_hovered_left = texture_pool.find(ResID::Tex_UIPlaceHoveredLeft)->second;
-		tex_hovered_right = texture_pool.find(ResID::Tex_UIPlaceHoveredRight)->second;
+		tex_idle = resources_manager->find_texture(ResID::Tex_UIPlaceIdle);
+		tex_hovered_top = resources_manager->find_texture(ResID::Tex_UIPlaceHoveredTop);
+		tex_hovered_left = resources_manager->find_texture(ResID::Tex_UIPlaceHoveredLeft);
+		tex_hovered_right = resources_manager->find_texture(ResID::Tex_UIPlaceHoveredRight);
 	};
 	~PlacePanel() = default;
 
@@ -29,7 +28,7 @@ public:
 	void on_update(SDL_Renderer *renderer) override
 	{
 		// TowerManagerのシングルトンインスタンスを取得、防御塔の建設コストを取得するために使用
-		static TowerManager *instance = TowerManager::instance();
+		TowerManager *instance = TowerManager::instance();
 
 		// 各種防御塔ユニットの建設コストを取得
 		val_top = (int)instance->get_place_cost(TowerType::Axeman);
@@ -67,15 +66,17 @@ public:
 			break;
 		}
 
-		// 範囲が0より大きい場合、その範囲の円形領域を描画
+		// 範囲が0より大きい場合、その範囲の円形領域を描画（視野範囲はアップグレード時のみ変わるため、半径ごとにキャッシュしたテクスチャを使用）
 		if (reg > 0)
 		{
+			PrimitiveCacheManager *primitive_cache = PrimitiveCacheManager::instance();
+			const int size_half = reg + PrimitiveCacheManager::get_circle_margin();
+			const SDL_Rect rect_dst = {center_pos.x - size_half, center_pos.y - size_half, size_half * 2 + 1, size_half * 2 + 1};
+
 			// 円形領域を塗りつぶし、タワー防衛ユニットの攻撃範囲を表示
-			filledCircleRGBA(renderer, center_pos.x, center_pos.y, reg,
-							 color_region_content.r, color_region_content.g, color_region_content.b, color_region_content.a);
+			SDL_RenderCopy(renderer, primitive_cache->find_filled_circle(renderer, reg, color_region_content), nullptr, &rect_dst);
 			// 円形の境界線を描画
-			aacircleRGBA(renderer, center_pos.x, center_pos.y, reg,
-						 color_region_edge.r, color_region_edge.g, color_region_edge.b, color_region_edge.a);
+			SDL_RenderCopy(renderer, primitive_cache->find_aa_circle(renderer, reg, color_region_edge), nullptr, &rect_dst);
 		}
 
 		// 基底クラスPanelのon_renderメソッドを呼び出し、他のレンダリングロジックを続行
@@ -11,6 +11,8 @@
 #include "facing.h"
 #include "tile.h"
 #include "map.h"
+#include "profile_manager.h"
+#include "sprite_batch_manager.h"
 
 #include <SDL.h>
 
@@ -76,6 +78,8 @@ public:
 
 	void on_update(double delta)
 	{
+		PROFILE_ZONE("PlayerManager::on_update");
+
 		timer_auto_increase_mp.on_update(delta);
 		timer_release_flash_cd.on_update(delta);
 
@@ -111,16 +115,16 @@ public:
 			switch (facing)
 			{
 			case Left:
-				anim_current = &anim_idle_left;
+				anim.set_clip(&clip_idle_left);
 				break;
 			case Right:
-				anim_current = &anim_idle_right;
+				anim.set_clip(&clip_idle_right);
 				break;
 			case Up:
-				anim_current = &anim_idle_up;
+				anim.set_clip(&clip_idle_up);
 				break;
 			case Down:
-				anim_current = &anim_idle_down;
+				anim.set_clip(&clip_idle_down);
 				break;
 			default:
 				break;
@@ -131,44 +135,43 @@ public:
 			switch (facing)
 			{
 			case Left:
-				anim_current = &anim_attack_left;
+				anim.set_clip(&clip_attack_left);
 				break;
 			case Right:
-				anim_current = &anim_attack_right;
+				anim.set_clip(&clip_attack_right);
 				break;
 			case Up:
-				anim_current = &anim_attack_up;
+				anim.set_clip(&clip_attack_up);
 				break;
 			case Down:
-				anim_current = &anim_attack_down;
+				anim.set_clip(&clip_attack_down);
 				break;
 			default:
 				break;
 			}
 		}
-		anim_current->on_update(delta);
+		anim.on_update(delta);
 
 		// フラッシュの解放（通常攻撃）
 		if (is_releasing_flash)
 		{
-			anim_effect_flash_current->on_update(delta);
+			anim_effect_flash.on_update(delta);
+			if (anim_effect_flash.check_finished())
+				is_releasing_flash = false;
 
-			EnemyManager::EnemyList &enemy_list = EnemyManager::instance()->get_enemy_list();
+			// ヒットボックス内にいる敵を空間グリッドから検索
+			static thread_local EnemyManager::EnemyList enemy_in_range_list;
+			EnemyManager::instance()->get_enemy_grid().query_rect(rect_hitbox_flash, enemy_in_range_list);
 
-			for (Enemy *enemy : enemy_list)
+			for (Enemy *enemy : enemy_in_range_list)
 			{
 				if (enemy->can_remove())
 					continue;
 
-				const Vector2 &position = enemy->get_position();
-				// ヒットボックスに基づく攻撃判定
-				if (position.x >= rect_hitbox_flash.x && position.x <= rect_hitbox_flash.x + rect_hitbox_flash.w && position.y >= rect_hitbox_flash.y && position.y <= rect_hitbox_flash.y + rect_hitbox_flash.h)
+				enemy->decrease_hp(ConfigManager::instance()->player_template.normal_attack_damage * delta);
+				if (enemy->can_remove())
 				{
-					enemy->decrease_hp(ConfigManager::instance()->player_template.normal_attack_damage * delta);
-					if (enemy->can_remove())
-					{
-						enemy->try_spawn_coin_prop(position, enemy->get_reward_ratio());
-					}
+					enemy->try_spawn_coin_prop(enemy->get_position(), enemy->get_reward_ratio());
 				}
 			}
 		}
@@ -176,31 +179,31 @@ public:
 		// インパクトの解放（特殊攻撃）
 		if (is_releasing_impact)
 		{
-			anim_effect_impact_current->on_update(delta);
+			anim_effect_impact.on_update(delta);
+			if (anim_effect_impact.check_finished())
+				is_releasing_impact = false;
 
-			EnemyManager::EnemyList &enemy_list = EnemyManager::instance()->get_enemy_list();
+			// ヒットボックス内にいる敵を空間グリッドから検索
+			static thread_local EnemyManager::EnemyList enemy_in_range_list;
+			EnemyManager::instance()->get_enemy_grid().query_rect(rect_hitbox_impact, enemy_in_range_list);
 
-			for (Enemy *enemy : enemy_list)
+			for (Enemy *enemy : enemy_in_range_list)
 			{
 				if (enemy->can_remove())
 					continue;
 
-				const Vector2 &position = enemy->get_position();
-				if (position.x >= rect_hitbox_impact.x && position.x <= rect_hitbox_impact.x + rect_hitbox_impact.w && position.y >= rect_hitbox_impact.y && position.y <= rect_hitbox_impact.y + rect_hitbox_impact.h)
+				enemy->decrease_hp(ConfigManager::instance()->player_template.skill_damage * delta);
+				enemy->slow_down();
+				if (enemy->can_remove())
 				{
-					enemy->decrease_hp(ConfigManager::instance()->player_template.skill_damage * delta);
-					enemy->slow_down();
-					if (enemy->can_remove())
-					{
-						enemy->try_spawn_coin_prop(position, enemy->get_reward_ratio());
-					}
+					enemy->try_spawn_coin_prop(enemy->get_position(), enemy->get_reward_ratio());
 				}
 			}
 		}
 
 		// コインを拾う
 		CoinManager::CoinPropList &coin_prop_list = CoinManager::instance()->get_coin_prop_list();
-		static const ResourcesManager::SoundPool &sound_pool = ResourcesManager::instance()->get_sound_pool();
+		const ResourcesManager *resources_manager = ResourcesManager::instance();
 		// すべてのコインを走査
 		for (CoinProp *coin_prop : coin_prop_list)
 		{
@@ -214,26 +217,28 @@ public:
 				coin_prop->make_invalid();
 				CoinManager::instance()->increase_coin(15);
 
-				Mix_PlayChannel(-1, sound_pool.find(ResID::Sound_Coin)->second, 0);
+				resources_manager->play_sound(ResID::Sound_Coin);
 			}
 		}
 	}
 
 	void on_render(SDL_Renderer *renderer)
 	{
-		static SDL_Point point;
+		PROFILE_ZONE("PlayerManager::on_render");
+
+		static thread_local SDL_Point point;
 
 		// プレイヤーの現在のアニメーションをレンダリング
 		point.x = (int)(position.x - size.x / 2);
 		point.y = (int)(position.y - size.y / 2);
-		anim_current->on_render(renderer, point);
+		anim.on_render(point);
 
 		// フラッシュアニメーションをレンダリング
 		if (is_releasing_flash)
 		{
 			point.x = rect_hitbox_flash.x;
 			point.y = rect_hitbox_flash.y;
-			anim_effect_flash_current->on_render(renderer, point);
+			anim_effect_flash.on_render(point);
 		}
 
 		// インパクトアニメーションをレンダリング
@@ -241,8 +246,10 @@ public:
 		{
 			point.x = rect_hitbox_impact.x;
 			point.y = rect_hitbox_impact.y;
-			anim_effect_impact_current->on_render(renderer, point);
+			anim_effect_impact.on_render(point);
 		}
+
+		SpriteBatchManager::instance()->flush(renderer);
 	}
 
 	// 現在のMPを取得
@@ -275,81 +282,68 @@ public:
 			});
 
 		// テクスチャプールを取得し、それぞれのアニメーションを設定
-		const ResourcesManager::TexturePool &tex_pool = ResourcesManager::instance()->get_texture_pool();
-		// アイドルと攻撃アニメーション
-		SDL_Texture *tex_player = tex_pool.find(ResID::Tex_Player)->second;
-
-		anim_idle_up.set_loop(true);
-		anim_idle_up.set_interval(0.1);
-		anim_idle_up.set_frame_data(tex_player, 4, 8, {4, 5, 6, 7});
-		anim_idle_down.set_loop(true);
-		anim_idle_down.set_interval(0.1);
-		anim_idle_down.set_frame_data(tex_player, 4, 8, {0, 1, 2, 3});
-		anim_idle_left.set_loop(true);
-		anim_idle_left.set_interval(0.1);
-		anim_idle_left.set_frame_data(tex_player, 4, 8, {8, 9, 10, 11});
-		anim_idle_right.set_loop(true);
-		anim_idle_right.set_interval(0.1);
-		anim_idle_right.set_frame_data(tex_player, 4, 8, {12, 13, 14, 15});
-
-		anim_attack_up.set_loop(true);
-		anim_attack_up.set_interval(0.1);
-		anim_attack_up.set_frame_data(tex_player, 4, 8, {20, 21});
-		anim_attack_down.set_loop(true);
-		anim_attack_down.set_interval(0.1);
-		anim_attack_down.set_frame_data(tex_player, 4, 8, {16, 17});
-		anim_attack_left.set_loop(true);
-		anim_attack_left.set_interval(0.1);
-		anim_attack_left.set_frame_data(tex_player, 4, 8, {24, 25});
-		anim_attack_right.set_loop(true);
-		anim_attack_right.set_interval(0.1);
-		anim_attack_right.set_frame_data(tex_player, 4, 8, {28, 29});
+		const ResourcesManager *resources_manager = ResourcesManager::instance();
+		// アイドルと攻撃アニメーション（テクスチャアトラス上の矩形から切り出す）
+		const TextureRegion region_player = resources_manager->find_region(ResID::Tex_Player);
+
+		clip_idle_up.set_loop(true);
+		clip_idle_up.set_interval(0.1);
+		clip_idle_up.set_frame_data(region_player, 4, 8, {4, 5, 6, 7});
+		clip_idle_down.set_loop(true);
+		clip_idle_down.set_interval(0.1);
+		clip_idle_down.set_frame_data(region_player, 4, 8, {0, 1, 2, 3});
+		clip_idle_left.set_loop(true);
+		clip_idle_left.set_interval(0.1);
+		clip_idle_left.set_frame_data(region_player, 4, 8, {8, 9, 10, 11});
+		clip_idle_right.set_loop(true);
+		clip_idle_right.set_interval(0.1);
+		clip_idle_right.set_frame_data(region_player, 4, 8, {12, 13, 14, 15});
+
+		clip_attack_up.set_loop(true);
+		clip_attack_up.set_interval(0.1);
+		clip_attack_up.set_frame_data(region_player, 4, 8, {20, 21});
+		clip_attack_down.set_loop(true);
+		clip_attack_down.set_interval(0.1);
+		clip_attack_down.set_frame_data(region_player, 4, 8, {16, 17});
+		clip_attack_left.set_loop(true);
+		clip_attack_left.set_interval(0.1);
+		clip_attack_left.set_frame_data(region_player, 4, 8, {24, 25});
+		clip_attack_right.set_loop(true);
+		clip_attack_right.set_interval(0.1);
+		clip_attack_right.set_frame_data(region_player, 4, 8, {28, 29});
 
 		// スキル解放アニメーション
-		anim_effect_flash_up.set_loop(false);
-		anim_effect_flash_up.set_interval(0.1);
-		anim_effect_flash_up.set_frame_data(tex_pool.find(ResID::Tex_EffectFlash_Up)->second, 5, 1, {0, 1, 2, 3, 4});
-		anim_effect_flash_up.set_on_finished([&]()
-											 { is_releasing_flash = false; });
-		anim_effect_flash_down.set_loop(false);
-		anim_effect_flash_down.set_interval(0.1);
-		anim_effect_flash_down.set_frame_data(tex_pool.find(ResID::Tex_EffectFlash_Down)->second, 5, 1, {4, 3, 2, 1, 0});
-		anim_effect_flash_down.set_on_finished([&]()
-											   { is_releasing_flash = false; });
-		anim_effect_flash_left.set_loop(false);
-		anim_effect_flash_left.set_interval(0.1);
-		anim_effect_flash_left.set_frame_data(tex_pool.find(ResID::Tex_EffectFlash_Left)->second, 1, 5, {4, 3, 2, 1, 0});
-		anim_effect_flash_left.set_on_finished([&]()
-											   { is_releasing_flash = false; });
-		anim_effect_flash_right.set_loop(false);
-		anim_effect_flash_right.set_interval(0.1);
-		anim_effect_flash_right.set_frame_data(tex_pool.find(ResID::Tex_EffectFlash_Right)->second, 1, 5, {0, 1, 2, 3, 4});
-		anim_effect_flash_right.set_on_finished([&]()
-												{ is_releasing_flash = false; });
-
-		anim_effect_impact_up.set_loop(false);
-		anim_effect_impact_up.set_interval(0.1);
-		anim_effect_impact_up.set_frame_data(tex_pool.find(ResID::Tex_EffectImpact_Up)->second, 5, 1, {0, 1, 2, 3, 4});
-		anim_effect_impact_up.set_on_finished([&]()
-											  { is_releasing_impact = false; });
-		anim_effect_impact_down.set_loop(false);
-		anim_effect_impact_up.set_interval(0.1);
-		anim_effect_impact_down.set_frame_data(tex_pool.find(ResID::Tex_EffectImpact_Down)->second, 5, 1, {4, 3, 2, 1, 0});
-		anim_effect_impact_down.set_on_finished([&]()
-												{ is_releasing_impact = false; });
-		anim_effect_impact_left.set_loop(false);
-		anim_effect_impact_up.set_interval(0.1);
-		anim_effect_impact_left.set_frame_data(tex_pool.find(ResID::Tex_EffectImpact_Left)->second, 1, 5, {4, 3, 2, 1, 0});
-		anim_effect_impact_left.set_on_finished([&]()
-												{ is_releasing_impact = false; });
-		anim_effect_impact_right.set_loop(false);
-		anim_effect_impact_up.set_interval(0.1);
-		anim_effect_impact_right.set_frame_data(tex_pool.find(ResID::Tex_EffectImpact_Right)->second, 1, 5, {0, 1, 2, 3, 4});
-		anim_effect_impact_right.set_on_finished([&]()
-												 { is_releasing_impact = false; });
+		clip_effect_flash_up.set_loop(false);
+		clip_effect_flash_up.set_interval(0.1);
+		clip_effect_flash_up.set_frame_data(resources_manager->find_region(ResID::Tex_EffectFlash_Up), 5, 1, {0, 1, 2, 3, 4});
+		clip_effect_flash_down.set_loop(false);
+		clip_effect_flash_down.set_interval(0.1);
+		clip_effect_flash_down.set_frame_data(resources_manager->find_region(ResID::Tex_EffectFlash_Down), 5, 1, {4, 3, 2, 1, 0});
+		clip_effect_flash_left.set_loop(false);
+		clip_effect_flash_left.set_interval(0.1);
+		clip_effect_flash_left.set_frame_data(resources_manager->find_region(ResID::Tex_EffectFlash_Left), 1, 5, {4, 3, 2, 1, 0});
+		clip_effect_flash_right.set_loop(false);
+		clip_effect_flash_right.set_interval(0.1);
+		clip_effect_flash_right.set_frame_data(resources_manager->find_region(ResID::Tex_EffectFlash_Right), 1, 5, {0, 1, 2, 3, 4});
+
+		clip_effect_impact_up.set_loop(false);
+		clip_effect_impact_up.set_interval(0.1);
+		clip_effect_impact_up.set_frame_data(resources_manager->find_region(ResID::Tex_EffectImpact_Up), 5, 1, {0, 1, 2, 3, 4});
+		clip_effect_impact_down.set_loop(false);
+		clip_effect_impact_down.set_interval(0.1);
+		clip_effect_impact_down.set_frame_data(resources_manager->find_region(ResID::Tex_EffectImpact_Down), 5, 1, {4, 3, 2, 1, 0});
+		clip_effect_impact_left.set_loop(false);
+		clip_effect_impact_left.set_interval(0.1);
+		clip_effect_impact_left.set_frame_data(resources_manager->find_region(ResID::Tex_EffectImpact_Left), 1, 5, {4, 3, 2, 1, 0});
+		clip_effect_impact_right.set_loop(false);
+		clip_effect_impact_right.set_interval(0.1);
+		clip_effect_impact_right.set_frame_data(resources_manager->find_region(ResID::Tex_EffectImpact_Right), 1, 5, {0, 1, 2, 3, 4});
+
+		// 右向きのアイドルアニメーションから再生
+		anim.play(&clip_idle_right);
 
 		// 初期位置の初期化（防御点の左側に配置）
-		static const SDL_Point &idx_home = ConfigManager::instance()->map.get_idx_home();
+		const SDL_Point &idx_home = ConfigManager::instance()->map.get_idx_home();
 		position.x = idx_home.x * SIZE_TILE - 48;
 		position.y = idx_home.y * SIZE_TILE;
 
@@ -388,28 +382,28 @@ private:
 
 	/* アニメーション関連 */
 	// アイドルアニメーション
-	Animation anim_idle_up;
-	Animation anim_idle_down;
-	Animation anim_idle_left;
-	Animation anim_idle_right;
+	AnimationClip clip_idle_up;
+	AnimationClip clip_idle_down;
+	AnimationClip clip_idle_left;
+	AnimationClip clip_idle_right;
 	// 攻撃アニメーション
-	Animation anim_attack_up;
-	Animation anim_attack_down;
-	Animation anim_attack_left;
-	Animation anim_attack_right;
-	Animation *anim_current = &anim_idle_right;
+	AnimationClip clip_attack_up;
+	AnimationClip clip_attack_down;
+	AnimationClip clip_attack_left;
+	AnimationClip clip_attack_right;
+	Animation anim;
 	// フラッシュエフェクト
-	Animation anim_effect_flash_up;
-	Animation anim_effect_flash_down;
-	Animation anim_effect_flash_left;
-	Animation anim_effect_flash_right;
-	Animation *anim_effect_flash_current = nullptr;
+	AnimationClip clip_effect_flash_up;
+	AnimationClip clip_effect_flash_down;
+	AnimationClip clip_effect_flash_left;
+	AnimationClip clip_effect_flash_right;
+	Animation anim_effect_flash;
 	// インパクトエフェクト
-	Animation anim_effect_impact_up;
-	Animation anim_effect_impact_down;
-	Animation anim_effect_impact_left;
-	Animation anim_effect_impact_right;
-	Animation *anim_effect_impact_current = nullptr;
+	AnimationClip clip_effect_impact_up;
+	AnimationClip clip_effect_impact_down;
+	AnimationClip clip_effect_impact_left;
+	AnimationClip clip_effect_impact_right;
+	Animation anim_effect_impact;
 
 	// タイマー
 	Timer timer_release_flash_cd;
@@ -427,25 +421,25 @@ private:
 		switch (facing)
 		{
 		case Left:
-			anim_effect_flash_current = &anim_effect_flash_left;
+			anim_effect_flash.play(&clip_effect_flash_left);
 			rect_hitbox_flash.x = (int)(position.x - size.x / 2 - 280); // ヒットボックスを左側に配置、中心位置から300px離れる
 			rect_hitbox_flash.y = (int)(position.y - 68 / 2);			// 高さを中央に配置
 			rect_hitbox_flash.w = 300, rect_hitbox_flash.h = 68;
 			break;
 		case Right:
-			anim_effect_flash_current = &anim_effect_flash_right;
+			anim_effect_flash.play(&clip_effect_flash_right);
 			rect_hitbox_flash.x = (int)(position.x + size.x / 2); // 右端に合わせる
 			rect_hitbox_flash.y = (int)(position.y - 68 / 2);
 			rect_hitbox_flash.w = 300, rect_hitbox_flash.h = 68;
 			break;
 		case Up:
-			anim_effect_flash_current = &anim_effect_flash_up;
+			anim_effect_flash.play(&clip_effect_flash_up);
 			rect_hitbox_flash.x = (int)(position.x - 68 / 2);			// x位置を中央に配置
 			rect_hitbox_flash.y = (int)(position.y - size.y / 2 - 280); // yをキャラクターの上端から300px上に配置
 			rect_hitbox_flash.w = 68, rect_hitbox_flash.h = 300;
 			break;
 		case Down:
-			anim_effect_flash_current = &anim_effect_flash_down;
+			anim_effect_flash.play(&clip_effect_flash_down);
 			rect_hitbox_flash.x = (int)(position.x - 68 / 2);	  // x位置を中央に配置
 			rect_hitbox_flash.y = (int)(position.y + size.y / 2); // 下端に合わせる
 			rect_hitbox_flash.w = 68, rect_hitbox_flash.h = 300;
@@ -455,11 +449,10 @@ private:
 		}
 
 		is_releasing_flash = true;
-		anim_effect_flash_current->reset();
 		timer_release_flash_cd.restart();
 
-		static const ResourcesManager::SoundPool &sound_pool = ResourcesManager::instance()->get_sound_pool();
-		Mix_PlayChannel(-1, sound_pool.find(ResID::Sound_Flash)->second, 0);
+		const ResourcesManager *resources_manager = ResourcesManager::instance();
+		resources_manager->play_sound(ResID::Sound_Flash);
 	}
 
 	void on_release_impact()
@@ -470,25 +463,25 @@ private:
 		switch (facing)
 		{
 		case Left:
-			anim_effect_impact_current = &anim_effect_impact_left;
+			anim_effect_impact.play(&clip_effect_impact_left);
 			rect_hitbox_impact.x = (int)(position.x - size.x / 2 - 40);
 			rect_hitbox_impact.y = (int)(position.y - 140 / 2);
 			rect_hitbox_impact.w = 60, rect_hitbox_impact.h = 140;
 			break;
 		case Right:
-			anim_effect_impact_current = &anim_effect_impact_right;
+			anim_effect_impact.play(&clip_effect_impact_right);
 			rect_hitbox_impact.x = (int)(position.x + size.x / 2);
 			rect_hitbox_impact.y = (int)(position.y - 140 / 2);
 			rect_hitbox_impact.w = 60, rect_hitbox_impact.h = 140;
 			break;
 		case Up:
-			anim_effect_impact_current = &anim_effect_impact_up;
+			anim_effect_impact.play(&clip_effect_impact_up);
 			rect_hitbox_impact.x = (int)(position.x - 140 / 2);
 			rect_hitbox_impact.y = (int)(position.y - size.y / 2 - 40);
 			rect_hitbox_impact.w = 140, rect_hitbox_impact.h = 60;
 			break;
 		case Down:
-			anim_effect_impact_current = &anim_effect_impact_down;
+			anim_effect_impact.play(&clip_effect_impact_down);
 			rect_hitbox_impact.x = (int)(position.x - 140 / 2);
 			rect_hitbox_impact.y = (int)(position.y + size.y / 2);
 			rect_hitbox_impact.w = 140, rect_hitbox_impact.h = 60;
@@ -499,10 +492,9 @@ private:
 
 		mp = 0;
 		is_releasing_impact = true;
-		anim_effect_impact_current->reset();
 
-		static const ResourcesManager::SoundPool &sound_pool = ResourcesManager::instance()->get_sound_pool();
-		Mix_PlayChannel(-1, sound_pool.find(ResID::Sound_Impact)->second, 0);
+		const ResourcesManager *resources_manager = ResourcesManager::instance();
+		resources_manager->play_sound(ResID::Sound_Impact);
 	}
 };
 
@@ -0,0 +1,173 @@
+#ifndef _PRIMITIVE_CACHE_MANAGER_H_
+#define _PRIMITIVE_CACHE_MANAGER_H_
+
+/**
+ * @brief 図形キャッシュ管理クラス
+ *
+ * このクラスは、SDL2_gfx で描画する図形（円、アンチエイリアスの円周、角丸矩形）を
+ * 形状と色の組み合わせごとに一度だけテクスチャに描画して保持するシングルトンクラスです。
+ * SDL2_gfx の図形は多数の点・線の描画呼び出しに分解されるため、毎フレーム描画する代わりに
+ * キャッシュしたテクスチャを SDL_RenderCopy で1回描画します。
+ *
+ * 主な機能:
+ * - find_filled_circle() / find_aa_circle() で半径と色に対応する円のテクスチャを取得
+ * - find_rounded_box() でサイズ・角の半径・色に対応する角丸矩形のテクスチャを取得
+ * - 初めて使用する組み合わせの場合のみ、レンダーターゲットのテクスチャに図形を描画して作成
+ *
+ * 使用方法:
+ * - 円のテクスチャは get_circle_margin() の分だけ半径より大きいため、
+ *   中心から (半径 + マージン) だけ左上にずらした位置に描画する
+ * - 角丸矩形のテクスチャは roundedBoxRGBA と同じく終点を含むため、(幅 + 1) x (高さ + 1) のサイズで描画する
+ *
+ * 注意事項:
+ * - レンダーターゲットの内容はデバイスのリセット（SDL_RENDER_TARGETS_RESET / SDL_RENDER_DEVICE_RESET）で失われるため、
+ *   そのイベントを受け取ったら clear() を呼び出してテクスチャを作成し直すこと
+ * - 組み合わせの数だけテクスチャが作成されるため、値が連続的に変化する図形（HPバーなど）は
+ *   ピクセル単位など有限の段階に丸めてから使用すること
+ * - clear() を呼び出さなかったテクスチャはレンダラーと共に解放されます
+ */
+
+#include "manager.h"
+
+#include <SDL.h>
+#include <map>
+#include <tuple>
+#include <SDL2_gfxPrimitives.h>
+
+class PrimitiveCacheManager : public Manager<PrimitiveCacheManager>
+{
+	friend class Manager<PrimitiveCacheManager>;
+
+public:
+	// 塗りつぶした円のテクスチャ（filledCircleRGBA と同じ結果）
+	SDL_Texture *find_filled_circle(SDL_Renderer *renderer, int radius, const SDL_Color &color)
+	{
+		return find_shape(renderer, {ShapeType::FilledCircle, radius, radius, radius, pack_color(color)});
+	}
+
+	// アンチエイリアスの円周のテクスチャ（aacircleRGBA と同じ結果）
+	SDL_Texture *find_aa_circle(SDL_Renderer *renderer, int radius, const SDL_Color &color)
+	{
+		return find_shape(renderer, {ShapeType::AACircle, radius, radius, radius, pack_color(color)});
+	}
+
+	// 角丸矩形のテクスチャ（roundedBoxRGBA(x, y, x + width, y + height, radius_corner) と同じ結果）
+	SDL_Texture *find_rounded_box(SDL_Renderer *renderer, int width, int height, int radius_corner, const SDL_Color &color)
+	{
+		return find_shape(renderer, {ShapeType::RoundedBox, width, height, radius_corner, pack_color(color)});
+	}
+
+	// 円のテクスチャの半径に対する余白（アンチエイリアスの画素が半径の外側にはみ出す分）
+	static constexpr int get_circle_margin()
+	{
+		return circle_margin;
+	}
+
+	// 作成したテクスチャの数
+	size_t get_num_texture() const
+	{
+		return texture_pool.size();
+	}
+
+	// すべてのテクスチャを破棄し、次に使用する際に作成し直す（レンダーターゲットのリセット時に使用）
+	void clear()
+	{
+		for (auto &pair : texture_pool)
+		{
+			if (pair.second)
+				SDL_DestroyTexture(pair.second);
+		}
+		texture_pool.clear();
+	}
+
+protected:
+	PrimitiveCacheManager() = default;
+	~PrimitiveCacheManager() = default;
+
+private:
+	static constexpr int circle_margin = 2;
+
+	enum class ShapeType
+	{
+		FilledCircle,
+		AACircle,
+		RoundedBox
+	};
+
+	// 図形の種類、サイズ（円の場合は幅と高さも半径）、半径、色（RGBA）の組み合わせ
+	struct ShapeKey
+	{
+		ShapeType type;
+		int width, height, radius;
+		Uint32 color;
+
+		bool operator<(const ShapeKey &key) const
+		{
+			return std::tie(type, width, height, radius, color) < std::tie(key.type, key.width, key.height, key.radius, key.color);
+		}
+	};
+
+private:
+	std::map<ShapeKey, SDL_Texture *> texture_pool;
+
+private:
+	static Uint32 pack_color(const SDL_Color &color)
+	{
+		return ((Uint32)color.r << 24) | ((Uint32)color.g << 16) | ((Uint32)color.b << 8) | color.a;
+	}
+
+	SDL_Texture *find_shape(SDL_Renderer *renderer, const ShapeKey &key)
+	{
+		const auto itor = texture_pool.find(key);
+		if (itor != texture_pool.end())
+			return itor->second;
+
+		SDL_Texture *texture = create_shape(renderer, key);
+		texture_pool[key] = texture; // 作成に失敗した場合も記録し、毎フレーム作成し直さない
+		return texture;
+	}
+
+	// レンダーターゲットのテクスチャに図形を描画
+	static SDL_Texture *create_shape(SDL_Renderer *renderer, const ShapeKey &key)
+	{
+		const bool is_circle = key.type != ShapeType::RoundedBox;
+		const int width = is_circle ? (key.radius + circle_margin) * 2 + 1 : key.width + 1;
+		const int height = is_circle ? (key.radius + circle_margin) * 2 + 1 : key.height + 1;
+
+		SDL_Texture *texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, width, height);
+		if (!texture)
+			return nullptr;
+		SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+		SDL_Texture *target_prev = SDL_GetRenderTarget(renderer);
+		SDL_SetRenderTarget(renderer, texture);
+
+		// 同じ色の透明でクリアし、半透明の画素をブレンドしても色が背景の黒と混ざらないようにする
+		const Uint8 r = (Uint8)(key.color >> 24), g = (Uint8)(key.color >> 16), b = (Uint8)(key.color >> 8), a = (Uint8)key.color;
+		SDL_BlendMode blend_mode_prev = SDL_BLENDMODE_NONE;
+		SDL_GetRenderDrawBlendMode(renderer, &blend_mode_prev);
+		SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+		SDL_SetRenderDrawColor(renderer, r, g, b, 0);
+		SDL_RenderClear(renderer);
+
+		const Sint16 center = (Sint16)(key.radius + circle_margin);
+		switch (key.type)
+		{
+		case ShapeType::FilledCircle:
+			filledCircleRGBA(renderer, center, center, (Sint16)key.radius, r, g, b, a);
+			break;
+		case ShapeType::AACircle:
+			aacircleRGBA(renderer, center, center, (Sint16)key.radius, r, g, b, a);
+			break;
+		case ShapeType::RoundedBox:
+			roundedBoxRGBA(renderer, 0, 0, (Sint16)key.width, (Sint16)key.height, (Sint16)key.radius, r, g, b, a);
+			break;
+		}
+
+		SDL_SetRenderDrawBlendMode(renderer, blend_mode_prev);
+		SDL_SetRenderTarget(renderer, target_prev);
+		return texture;
+	}
+};
+
+#endif // !_PRIMITIVE_CACHE_MANAGER_H_
@@ -0,0 +1,203 @@
+#ifndef _PROFILE_MANAGER_H_
+#define _PROFILE_MANAGER_H_
+
+/**
+ * @brief プロファイル管理クラス
+ *
+ * このクラスは、処理区間（ゾーン）の計測と、Chrome / Perfetto形式のトレース出力を担当するシングルトンクラスです。
+ *
+ * 主な機能:
+ * - PROFILE_ZONE("名前") マクロによるスコープ単位の計測
+ * - PROFILE_COUNTER("名前", 値) マクロによる数値（オブジェクトプールの確保回数など）の記録
+ * - 指定したフレーム数の計測結果をtrace_event形式のJSONファイルに出力
+ *   （chrome://tracing または https://ui.perfetto.dev で表示可能）
+ *
+ * 使用方法:
+ * - 計測したい関数やブロックの先頭に PROFILE_ZONE("EnemyManager::on_update") を記述
+ * - ProfileManager::instance()->start_capture() で記録を開始
+ * - 各フレームの始めに ProfileManager::instance()->on_frame_begin() を呼び出す
+ *
+ * リリースビルド（NDEBUGが定義されている場合）では、マクロは空になり計測コードは生成されません。
+ */
+
+#include "manager.h"
+#include "alloc_counter.h"
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iomanip>
+
+class ProfileManager : public Manager<ProfileManager>
+{
+	friend class Manager<ProfileManager>;
+
+public:
+	typedef std::chrono::steady_clock Clock;
+
+public:
+	// 記録を開始し、num_frameフレーム分を記録した後にpathへ出力する
+	void start_capture(const std::string &path, int num_frame)
+	{
+		path_trace = path;
+		num_frame_capture = num_frame;
+		idx_frame = 0;
+		event_list.clear();
+		time_capture_begin = Clock::now();
+		is_capturing = true;
+	}
+
+	// 記録を終了し、ファイルに出力（記録中でない場合は何もしない）
+	bool stop_capture()
+	{
+		if (!is_capturing)
+			return true;
+		is_capturing = false;
+		return write_trace();
+	}
+
+	bool check_capturing() const
+	{
+		return is_capturing;
+	}
+
+	// フレームの開始（前のフレームまでで指定フレーム数に達した場合は記録を終了して出力）
+	void on_frame_begin()
+	{
+		if (is_capturing && idx_frame++ >= num_frame_capture)
+			stop_capture();
+	}
+
+	// ゾーンの計測結果を記録
+	void add_event(const char *name, Clock::time_point time_begin, Clock::time_point time_end)
+	{
+		if (!is_capturing)
+			return;
+
+		Event event;
+		event.name = name;
+		event.phase = 'X';
+		event.time_begin = std::chrono::duration<double, std::micro>(time_begin - time_capture_begin).count();
+		event.duration = std::chrono::duration<double, std::micro>(time_end - time_begin).count();
+
+		AllocCounter::Pause pause; // 記録用の確保は計測対象のヒープ確保回数に含めない
+		event_list.push_back(event);
+	}
+
+	// カウンターの値を記録（トレース上では時系列のグラフとして表示される）
+	void add_counter(const char *name, double value)
+	{
+		if (!is_capturing)
+			return;
+
+		Event event;
+		event.name = name;
+		event.phase = 'C';
+		event.time_begin = std::chrono::duration<double, std::micro>(Clock::now() - time_capture_begin).count();
+		event.value = value;
+
+		AllocCounter::Pause pause; // 記録用の確保は計測対象のヒープ確保回数に含めない
+		event_list.push_back(event);
+	}
+
+protected:
+	ProfileManager()
+	{
+		// スレッドごとのインスタンスに、トレース上のスレッド番号を割り当てる
+		static std::atomic<int> num_thread(0);
+		id_thread = ++num_thread;
+	}
+	~ProfileManager()
+	{
+		stop_capture();
+	}
+
+private:
+	// 1つのゾーンまたはカウンターの記録（時刻はマイクロ秒）
+	struct Event
+	{
+		const char *name = nullptr;
+		char phase = 'X'; // 'X'：ゾーン（完了イベント）、'C'：カウンター
+		double time_begin = 0;
+		double duration = 0;
+		double value = 0; // カウンターの値
+	};
+
+private:
+	bool is_capturing = false;
+	std::string path_trace;
+	int num_frame_capture = 0;
+	int idx_frame = 0;
+	int id_thread = 0;
+
+	Clock::time_point time_capture_begin;
+	std::vector<Event> event_list;
+
+private:
+	// trace_event形式（完了イベント "ph":"X"、カウンターイベント "ph":"C"）のJSONを出力
+	bool write_trace() const
+	{
+		std::ofstream file(path_trace);
+		if (!file.good())
+			return false;
+
+		// 時刻はマイクロ秒単位のため、既定の有効数字6桁では記録開始から約1秒以降の精度が失われる。小数点以下3桁（ナノ秒）まで固定小数点で出力
+		file << std::fixed << std::setprecision(3);
+		file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+		for (size_t i = 0; i < event_list.size(); i++)
+		{
+			const Event &event = event_list[i];
+			file << (i == 0 ? "\n" : ",\n")
+				 << "{\"name\":\"" << event.name << "\",\"ph\":\"" << event.phase << "\",\"pid\":1,\"tid\":" << id_thread
+				 << ",\"ts\":" << event.time_begin;
+			if (event.phase == 'C')
+				file << ",\"args\":{\"value\":" << event.value << "}}";
+			else
+				file << ",\"dur\":" << event.duration << "}";
+		}
+		file << "\n]}" << std::endl;
+
+		return file.good();
+	}
+};
+
+/*スコープの開始から終了までを計測し、ProfileManagerに記録する*/
+class ProfileZone
+{
+public:
+	ProfileZone(const char *name) : name(name)
+	{
+		// 記録中でない場合は時刻の取得も行わない
+		is_active = ProfileManager::instance()->check_capturing();
+		if (is_active)
+			time_begin = ProfileManager::Clock::now();
+	}
+	~ProfileZone()
+	{
+		if (is_active)
+			ProfileManager::instance()->add_event(name, time_begin, ProfileManager::Clock::now());
+	}
+
+	ProfileZone(const ProfileZone &) = delete;
+	ProfileZone &operator=(const ProfileZone &) = delete;
+
+private:
+	const char *name = nullptr;
+	bool is_active = false;
+	ProfileManager::Clock::time_point time_begin;
+};
+
+// 計測マクロ（リリースビルドでは何も生成しない）
+#ifdef NDEBUG
+#define PROFILE_ZONE(name)
+#define PROFILE_COUNTER(name, value)
+#else
+#define PROFILE_ZONE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_ZONE_CONCAT(a, b) PROFILE_ZONE_CONCAT_IMPL(a, b)
+#define PROFILE_ZONE(name) ProfileZone PROFILE_ZONE_CONCAT(profile_zone_, __LINE__)(name)
+#define PROFILE_COUNTER(name, value) ProfileManager::instance()->add_counter(name, (double)(value))
+#endif
+
+#endif // !_PROFILE_MANAGER_H_
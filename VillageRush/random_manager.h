@@ -0,0 +1,114 @@
+#ifndef _RANDOM_MANAGER_H_
+#define _RANDOM_MANAGER_H_
+
+/**
+ * @brief 乱数管理クラス
+ *
+ * このクラスは、ゲームワールド内のすべての乱数を生成するシングルトンクラスです。
+ *
+ * 主な機能:
+ * - シード値による乱数列の初期化（同じシードで同じゲーム結果を再現可能）
+ * - ゲームプレイ用の乱数列（コインのドロップ判定、コインの飛び出し方向など）
+ * - 演出用の乱数列（効果音の選択など）
+ *
+ * 使用方法:
+ * - RandomManager::instance()->set_seed() でシードを設定
+ * - gameplay_real() / gameplay_int() でゲーム結果に影響する乱数を取得
+ * - cosmetic_int() でゲーム結果に影響しない演出用の乱数を取得
+ * - generate_real() / generate_int() でワールド外の乱数エンジンから同じ変換で乱数を取得
+ *
+ * 注意事項:
+ * - 演出用の乱数列はゲームプレイ用と独立しているため、効果音の有無（ヘッドレスモードなど）が
+ *   ゲームプレイ用の乱数列に影響することはない
+ * - std::uniform_*_distribution の結果は標準ライブラリの実装によって異なるため使用せず、
+ *   mt19937 の出力（規格で定められている）から直接変換する。これにより、同じシードで
+ *   MSVC のゲームと Linux のヘッドレス・スイープ・ベンチマークツールが同じ乱数列になる
+ */
+
+#include "manager.h"
+
+#include <random>
+#include <cstdint>
+
+class RandomManager : public Manager<RandomManager>
+{
+	friend class Manager<RandomManager>;
+
+public:
+	// シードを設定し、両方の乱数列を初期化
+	void set_seed(uint32_t seed)
+	{
+		this->seed = seed;
+
+		// 同じシードから異なる乱数列を得るため、系統ごとに異なる値を加えてシードシーケンスを作る
+		std::seed_seq seed_gameplay = {seed, 0u};
+		std::seed_seq seed_cosmetic = {seed, 1u};
+		engine_gameplay.seed(seed_gameplay);
+		engine_cosmetic.seed(seed_cosmetic);
+	}
+
+	// 現在のシードを取得（結果を再現するために使用）
+	uint32_t get_seed() const
+	{
+		return seed;
+	}
+
+	// ゲームプレイ用：[0, 1)の実数を生成
+	double gameplay_real()
+	{
+		return generate_real(engine_gameplay);
+	}
+
+	// ゲームプレイ用：[0, n)の整数を生成
+	int gameplay_int(int n)
+	{
+		return generate_int(engine_gameplay, n);
+	}
+
+	// 演出用：[0, n)の整数を生成
+	int cosmetic_int(int n)
+	{
+		return generate_int(engine_cosmetic, n);
+	}
+
+protected:
+	RandomManager()
+	{
+		// シードが指定されない場合は、起動ごとに異なるシードを使用
+		set_seed(std::random_device()());
+	}
+	~RandomManager() = default;
+
+public:
+	// 以下の変換は任意の mt19937 に使用可能（ベンチマークのシナリオ生成など、ワールド外の乱数列にも使用する）
+
+	// 32ビットの出力2つから53ビットの精度の[0, 1)の実数を生成（genrand_res53 と同じ変換）
+	static double generate_real(std::mt19937 &engine)
+	{
+		const uint32_t a = engine() >> 5, b = engine() >> 6;
+		return (a * 67108864.0 + b) * (1.0 / 9007199254740992.0);
+	}
+
+	// 棄却法で偏りのない[0, n)の整数を生成（n <= 0 の場合は0）
+	static int generate_int(std::mt19937 &engine, int n)
+	{
+		if (n <= 1)
+			return 0;
+
+		// 2^32 を n で割った余りの分だけ先頭の値を棄却し、残りの範囲を n 等分する
+		const uint32_t range = (uint32_t)n;
+		const uint32_t threshold = (uint32_t)(-range) % range;
+		uint32_t val = engine();
+		while (val < threshold)
+			val = engine();
+		return (int)(val % range);
+	}
+
+private:
+	uint32_t seed = 0;
+
+	std::mt19937 engine_gameplay; // ゲームプレイ用の乱数列
+	std::mt19937 engine_cosmetic; // 演出用の乱数列
+};
+
+#endif // !_RANDOM_MANAGER_H_
@@ -0,0 +1,276 @@
+#ifndef _REPLAY_MANAGER_H_
+#define _REPLAY_MANAGER_H_
+
+/**
+ * @brief リプレイ管理クラス
+ *
+ * このクラスは、プレイ中の入力イベントの記録と再生を担当するシングルトンクラスです。
+ *
+ * 主な機能:
+ * - ゲームが処理する入力イベント（終了、キー、マウス）を刻み番号とともにバイナリファイルに記録
+ * - 記録ファイルを読み込み、記録時と同じ刻みでイベントを再生
+ * - 記録時の乱数シードと刻みレートの保存（同じ結果を再現するため）
+ *
+ * ファイル形式（リトルエンディアン）:
+ * - ヘッダー: "VRRP"(4) + バージョン(u16) + 刻みレート(u16) + シード(u32)
+ * - レコード: 刻み番号(u32) + イベントタイプ(u8) + ペイロード
+ *   （キー: キーコード(i32)、マウス: x(i16) + y(i16)、終了: なし）
+ *
+ * 使用方法:
+ * - start_record() で記録を開始し、record() で各イベントを記録
+ * - start_replay() で再生を開始し、poll() で各刻みのイベントを取り出す
+ * - stop() で記録ファイルを閉じる
+ */
+
+#include "manager.h"
+
+#include <SDL.h>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <fstream>
+
+class ReplayManager : public Manager<ReplayManager>
+{
+	friend class Manager<ReplayManager>;
+
+public:
+	// 記録を開始し、ヘッダー（刻みレートとシード）を書き込む
+	bool start_record(const std::string &path, uint32_t seed, int tick_rate)
+	{
+		file_record.open(path, std::ios::binary | std::ios::trunc);
+		if (!file_record.good())
+			return false;
+
+		this->seed = seed;
+		this->tick_rate = tick_rate;
+
+		file_record.write(magic, sizeof(magic));
+		write_value<uint16_t>(version);
+		write_value<uint16_t>((uint16_t)tick_rate);
+		write_value<uint32_t>(seed);
+
+		mode = Mode::Record;
+		return true;
+	}
+
+	// 記録ファイルを読み込み、再生を開始
+	bool start_replay(const std::string &path)
+	{
+		std::ifstream file(path, std::ios::binary);
+		if (!file.good())
+			return false;
+
+		// ヘッダーの検証
+		char magic_file[4] = {0};
+		uint16_t version_file = 0, tick_rate_file = 0;
+		file.read(magic_file, sizeof(magic_file));
+		read_value(file, version_file);
+		read_value(file, tick_rate_file);
+		read_value(file, seed);
+		if (!file.good() || std::string(magic_file, 4) != std::string(magic, 4) || version_file != version || tick_rate_file == 0)
+			return false;
+		tick_rate = tick_rate_file;
+
+		// レコードをすべて読み込む
+		record_list.clear();
+		while (true)
+		{
+			Record record;
+			uint8_t type = 0;
+			if (!read_value(file, record.tick) || !read_value(file, type))
+				break;
+			record.type = (EventType)type;
+
+			switch (record.type)
+			{
+			case EventType::Quit:
+				break;
+			case EventType::KeyDown:
+			case EventType::KeyUp:
+				read_value(file, record.key);
+				break;
+			case EventType::MouseMotion:
+			case EventType::MouseButtonDown:
+			case EventType::MouseButtonUp:
+				read_value(file, record.x);
+				read_value(file, record.y);
+				break;
+			default:
+				return false;
+			}
+			if (!file.good())
+				return false;
+
+			record_list.push_back(record);
+		}
+
+		idx_record = 0;
+		mode = Mode::Replay;
+		return true;
+	}
+
+	// 記録ファイルを閉じる
+	void stop()
+	{
+		if (file_record.is_open())
+			file_record.close();
+	}
+
+	bool is_recording() const
+	{
+		return mode == Mode::Record;
+	}
+
+	bool is_replaying() const
+	{
+		return mode == Mode::Replay;
+	}
+
+	// すべてのイベントを再生し終えたかどうか
+	bool check_replay_end() const
+	{
+		return idx_record >= record_list.size();
+	}
+
+	uint32_t get_seed() const
+	{
+		return seed;
+	}
+
+	int get_tick_rate() const
+	{
+		return tick_rate;
+	}
+
+	// 入力イベントを記録（ゲームが処理しないイベントタイプは無視する）
+	void record(uint64_t tick, const SDL_Event &event)
+	{
+		if (mode != Mode::Record)
+			return;
+
+		switch (event.type)
+		{
+		case SDL_QUIT:
+			write_header(tick, EventType::Quit);
+			break;
+		case SDL_KEYDOWN:
+		case SDL_KEYUP:
+			write_header(tick, event.type == SDL_KEYDOWN ? EventType::KeyDown : EventType::KeyUp);
+			write_value<int32_t>(event.key.keysym.sym);
+			break;
+		case SDL_MOUSEMOTION:
+			write_header(tick, EventType::MouseMotion);
+			write_value<int16_t>((int16_t)event.motion.x);
+			write_value<int16_t>((int16_t)event.motion.y);
+			break;
+		case SDL_MOUSEBUTTONDOWN:
+		case SDL_MOUSEBUTTONUP:
+			write_header(tick, event.type == SDL_MOUSEBUTTONDOWN ? EventType::MouseButtonDown : EventType::MouseButtonUp);
+			write_value<int16_t>((int16_t)event.button.x);
+			write_value<int16_t>((int16_t)event.button.y);
+			break;
+		default:
+			break;
+		}
+	}
+
+	// 指定された刻みで再生すべき次のイベントを取り出す（ない場合はfalseを返す）
+	bool poll(uint64_t tick, SDL_Event &event)
+	{
+		if (mode != Mode::Replay || idx_record >= record_list.size() || record_list[idx_record].tick > tick)
+			return false;
+
+		const Record &record = record_list[idx_record++];
+		event = SDL_Event();
+		switch (record.type)
+		{
+		case EventType::Quit:
+			event.type = SDL_QUIT;
+			break;
+		case EventType::KeyDown:
+		case EventType::KeyUp:
+			event.type = record.type == EventType::KeyDown ? SDL_KEYDOWN : SDL_KEYUP;
+			event.key.keysym.sym = record.key;
+			break;
+		case EventType::MouseMotion:
+			event.type = SDL_MOUSEMOTION;
+			event.motion.x = record.x, event.motion.y = record.y;
+			break;
+		case EventType::MouseButtonDown:
+		case EventType::MouseButtonUp:
+			event.type = record.type == EventType::MouseButtonDown ? SDL_MOUSEBUTTONDOWN : SDL_MOUSEBUTTONUP;
+			event.button.x = record.x, event.button.y = record.y;
+			break;
+		}
+		return true;
+	}
+
+protected:
+	ReplayManager() = default;
+	~ReplayManager()
+	{
+		stop();
+	}
+
+private:
+	enum class Mode
+	{
+		None,
+		Record,
+		Replay
+	};
+
+	// ファイルに保存するイベントタイプ
+	enum class EventType : uint8_t
+	{
+		Quit,
+		KeyDown,
+		KeyUp,
+		MouseMotion,
+		MouseButtonDown,
+		MouseButtonUp
+	};
+
+	// 再生用に読み込んだレコード
+	struct Record
+	{
+		uint32_t tick = 0;
+		EventType type = EventType::Quit;
+		int32_t key = 0;
+		int16_t x = 0, y = 0;
+	};
+
+private:
+	const char magic[4] = {'V', 'R', 'R', 'P'};
+	const uint16_t version = 2; // 乱数の変換方法の変更で同じシードの乱数列が変わったため、以前のリプレイは読み込まない
+
+	Mode mode = Mode::None;
+	uint32_t seed = 0;
+	int tick_rate = 0;
+
+	std::ofstream file_record;		 // 記録先のファイル
+	std::vector<Record> record_list; // 再生するレコードのリスト
+	size_t idx_record = 0;			 // 次に再生するレコードのインデックス
+
+private:
+	template <typename T>
+	void write_value(T val)
+	{
+		file_record.write(reinterpret_cast<const char *>(&val), sizeof(T));
+	}
+
+	template <typename T>
+	bool read_value(std::ifstream &file, T &val)
+	{
+		return (bool)file.read(reinterpret_cast<char *>(&val), sizeof(T));
+	}
+
+	void write_header(uint64_t tick, EventType type)
+	{
+		write_value<uint32_t>((uint32_t)tick);
+		write_value<uint8_t>((uint8_t)type);
+	}
+};
+
+#endif // !_REPLAY_MANAGER_H_
@@ -2,8 +2,22 @@
 #define _RESOURCES_MANAGER_H_
 
 #include "manager.h"
-
+#include "profile_manager.h"
+#include "config_manager.h"
+#include "texture_atlas.h"
+#include "glyph_atlas.h"
+#include "archive_manager.h"
+#include "decode_cache.h"
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <functional>
 #include <unordered_map>
+#include <condition_variable>
 #include <SDL_ttf.h>
 #include <SDL_mixer.h>
 #include <SDL_image.h>
@@ -21,19 +35,6 @@ enum class ResID
 	Tex_Axeman,
 	Tex_Gunner,
 
-	// 敵の画像
-	Tex_Slime,
-	Tex_KingSlime,
-	Tex_Skeleton,
-	Tex_Goblin,
-	Tex_GoblinPriest,
-	// シルエット画像、敵のダメージエフェクトを表現するために使用
-	Tex_SlimeSketch,
-	Tex_KingSlimeSketch,
-	Tex_SkeletonSketch,
-	Tex_GoblinSketch,
-	Tex_GoblinPriestSketch,
-
 	// 防御タワーの弾薬
 	Tex_BulletArrow,
 	Tex_BulletAxe,
@@ -105,7 +106,8 @@ enum class ResID
 	Music_BGM,
 
 	// フォント
-	Font_Main
+	Font_Main,
+	Font_Small
 };
 
 class ResourcesManager : public Manager<ResourcesManager>
@@ -117,63 +119,163 @@ public:
 	typedef std::unordered_map<ResID, Mix_Chunk *> SoundPool;
 	typedef std::unordered_map<ResID, Mix_Music *> MusicPool;
 	typedef std::unordered_map<ResID, SDL_Texture *> TexturePool;
+	typedef std::unordered_map<ResID, std::string> SpritePathPool; // テクスチャアトラスに詰め込む画像のパス
+	typedef std::unordered_map<ResID, GlyphAtlas> GlyphAtlasPool;	  // フォントごとのグリフアトラス
+	typedef std::function<void(double progress)> ProgressCallback; // 読み込みの進捗（0～1）の通知
 
 public:
 	/*外部からリソースを読み込み、戻り値でリソースの読み込み成功を判断できる*/
-	bool load_from_file(SDL_Renderer *renderer)
+	// 画像と効果音のデコードはワーカースレッドで並列に行い、テクスチャの作成（レンダラーの操作）はメインスレッドで行う
+	// アーカイブ（ArchiveManager）が開かれている場合、すべてのファイルはアーカイブのメモリから直接読み込む
+	// デコードした画素とPCMはファイルの内容のハッシュ値をキーとしてキャッシュし、2回目以降の起動ではデコードを省略する
+	// on_progress は進捗（0～1）が進むたびにメインスレッドで呼び出される（ロード画面の描画などに使用）
+	bool load_from_file(SDL_Renderer *renderer, ProgressCallback on_progress = nullptr)
 	{
-		// IMG_LoadTextureを使用して直接テクスチャを読み込み、対応するIDに保存
-		texture_pool[ResID::Tex_Tileset] = IMG_LoadTexture(renderer, "resources/tileset.png");
-
-		texture_pool[ResID::Tex_Player] = IMG_LoadTexture(renderer, "resources/player.png");
-		texture_pool[ResID::Tex_Archer] = IMG_LoadTexture(renderer, "resources/tower_archer.png");
-		texture_pool[ResID::Tex_Axeman] = IMG_LoadTexture(renderer, "resources/tower_axeman.png");
-		texture_pool[ResID::Tex_Gunner] = IMG_LoadTexture(renderer, "resources/tower_gunner.png");
-
-		texture_pool[ResID::Tex_Slime] = IMG_LoadTexture(renderer, "resources/enemy_slime.png");
-		texture_pool[ResID::Tex_KingSlime] = IMG_LoadTexture(renderer, "resources/enemy_king_slime.png");
-		texture_pool[ResID::Tex_Skeleton] = IMG_LoadTexture(renderer, "resources/enemy_skeleton.png");
-		texture_pool[ResID::Tex_Goblin] = IMG_LoadTexture(renderer, "resources/enemy_goblin.png");
-		texture_pool[ResID::Tex_GoblinPriest] = IMG_LoadTexture(renderer, "resources/enemy_goblin_priest.png");
-		texture_pool[ResID::Tex_SlimeSketch] = IMG_LoadTexture(renderer, "resources/enemy_slime_sketch.png");
-		texture_pool[ResID::Tex_KingSlimeSketch] = IMG_LoadTexture(renderer, "resources/enemy_king_slime_sketch.png");
-		texture_pool[ResID::Tex_SkeletonSketch] = IMG_LoadTexture(renderer, "resources/enemy_skeleton_sketch.png");
-		texture_pool[ResID::Tex_GoblinSketch] = IMG_LoadTexture(renderer, "resources/enemy_goblin_sketch.png");
-		texture_pool[ResID::Tex_GoblinPriestSketch] = IMG_LoadTexture(renderer, "resources/enemy_goblin_priest_sketch.png");
-
-		texture_pool[ResID::Tex_BulletArrow] = IMG_LoadTexture(renderer, "resources/bullet_arrow.png");
-		texture_pool[ResID::Tex_BulletAxe] = IMG_LoadTexture(renderer, "resources/bullet_axe.png");
-		texture_pool[ResID::Tex_BulletShell] = IMG_LoadTexture(renderer, "resources/bullet_shell.png");
-
-		texture_pool[ResID::Tex_Coin] = IMG_LoadTexture(renderer, "resources/coin.png");
-		texture_pool[ResID::Tex_Home] = IMG_LoadTexture(renderer, "resources/home.png");
-
-		texture_pool[ResID::Tex_EffectFlash_Up] = IMG_LoadTexture(renderer, "resources/effect_flash_up.png");
-		texture_pool[ResID::Tex_EffectFlash_Down] = IMG_LoadTexture(renderer, "resources/effect_flash_down.png");
-		texture_pool[ResID::Tex_EffectFlash_Left] = IMG_LoadTexture(renderer, "resources/effect_flash_left.png");
-		texture_pool[ResID::Tex_EffectFlash_Right] = IMG_LoadTexture(renderer, "resources/effect_flash_right.png");
-		texture_pool[ResID::Tex_EffectImpact_Up] = IMG_LoadTexture(renderer, "resources/effect_impact_up.png");
-		texture_pool[ResID::Tex_EffectImpact_Down] = IMG_LoadTexture(renderer, "resources/effect_impact_down.png");
-		texture_pool[ResID::Tex_EffectImpact_Left] = IMG_LoadTexture(renderer, "resources/effect_impact_left.png");
-		texture_pool[ResID::Tex_EffectImpact_Right] = IMG_LoadTexture(renderer, "resources/effect_impact_right.png");
-		texture_pool[ResID::Tex_EffectExplode] = IMG_LoadTexture(renderer, "resources/effect_explode.png");
-
-		texture_pool[ResID::Tex_UISelectCursor] = IMG_LoadTexture(renderer, "resources/ui_select_cursor.png");
-		texture_pool[ResID::Tex_UIPlaceIdle] = IMG_LoadTexture(renderer, "resources/ui_place_idle.png");
-		texture_pool[ResID::Tex_UIPlaceHoveredTop] = IMG_LoadTexture(renderer, "resources/ui_place_hovered_top.png");
-		texture_pool[ResID::Tex_UIPlaceHoveredLeft] = IMG_LoadTexture(renderer, "resources/ui_place_hovered_left.png");
-		texture_pool[ResID::Tex_UIPlaceHoveredRight] = IMG_LoadTexture(renderer, "resources/ui_place_hovered_right.png");
-		texture_pool[ResID::Tex_UIUpgradeIdle] = IMG_LoadTexture(renderer, "resources/ui_upgrade_idle.png");
-		texture_pool[ResID::Tex_UIUpgradeHoveredTop] = IMG_LoadTexture(renderer, "resources/ui_upgrade_hovered_top.png");
-		texture_pool[ResID::Tex_UIUpgradeHoveredLeft] = IMG_LoadTexture(renderer, "resources/ui_upgrade_hovered_left.png");
-		texture_pool[ResID::Tex_UIUpgradeHoveredRight] = IMG_LoadTexture(renderer, "resources/ui_upgrade_hovered_right.png");
-		texture_pool[ResID::Tex_UIHomeAvatar] = IMG_LoadTexture(renderer, "resources/ui_home_avatar.png");
-		texture_pool[ResID::Tex_UIPlayerAvatar] = IMG_LoadTexture(renderer, "resources/ui_player_avatar.png");
-		texture_pool[ResID::Tex_UIHeart] = IMG_LoadTexture(renderer, "resources/ui_heart.png");
-		texture_pool[ResID::Tex_UICoin] = IMG_LoadTexture(renderer, "resources/ui_coin.png");
-		texture_pool[ResID::Tex_UIGameOverBar] = IMG_LoadTexture(renderer, "resources/ui_game_over_bar.png");
-		texture_pool[ResID::Tex_UIWinText] = IMG_LoadTexture(renderer, "resources/ui_win_text.png");
-		texture_pool[ResID::Tex_UILossText] = IMG_LoadTexture(renderer, "resources/ui_loss_text.png");
+		PROFILE_ZONE("ResourcesManager::load_from_file");
+
+		// ゲームワールドに描画するスプライト（キャラクター、防御タワー、弾薬、コイン、エフェクト）は、
+		// テクスチャアトラスに詰め込んでスプライトバッチの描画呼び出しをまとめられるようにする
+		sprite_path_pool[ResID::Tex_Player] = "resources/player.png";
+		sprite_path_pool[ResID::Tex_Archer] = "resources/tower_archer.png";
+		sprite_path_pool[ResID::Tex_Axeman] = "resources/tower_axeman.png";
+		sprite_path_pool[ResID::Tex_Gunner] = "resources/tower_gunner.png";
+
+		sprite_path_pool[ResID::Tex_BulletArrow] = "resources/bullet_arrow.png";
+		sprite_path_pool[ResID::Tex_BulletAxe] = "resources/bullet_axe.png";
+		sprite_path_pool[ResID::Tex_BulletShell] = "resources/bullet_shell.png";
+
+		sprite_path_pool[ResID::Tex_Coin] = "resources/coin.png";
+
+		sprite_path_pool[ResID::Tex_EffectFlash_Up] = "resources/effect_flash_up.png";
+		sprite_path_pool[ResID::Tex_EffectFlash_Down] = "resources/effect_flash_down.png";
+		sprite_path_pool[ResID::Tex_EffectFlash_Left] = "resources/effect_flash_left.png";
+		sprite_path_pool[ResID::Tex_EffectFlash_Right] = "resources/effect_flash_right.png";
+		sprite_path_pool[ResID::Tex_EffectImpact_Up] = "resources/effect_impact_up.png";
+		sprite_path_pool[ResID::Tex_EffectImpact_Down] = "resources/effect_impact_down.png";
+		sprite_path_pool[ResID::Tex_EffectImpact_Left] = "resources/effect_impact_left.png";
+		sprite_path_pool[ResID::Tex_EffectImpact_Right] = "resources/effect_impact_right.png";
+		sprite_path_pool[ResID::Tex_EffectExplode] = "resources/effect_explode.png";
+
+		std::vector<std::string> path_atlas_list;
+		for (const auto &pair : sprite_path_pool)
+			path_atlas_list.push_back(pair.second);
+
+		// 敵の種類ごとのテクスチャ（ゲーム設定に記述されたパス）も詰め込む
+		for (const ConfigManager::EnemyTemplate &tpl : ConfigManager::instance()->enemy_template_list)
+		{
+			for (const std::string &path : {tpl.path_texture, tpl.path_texture_sketch})
+			{
+				if (std::find(path_atlas_list.begin(), path_atlas_list.end(), path) == path_atlas_list.end())
+					path_atlas_list.push_back(path);
+			}
+		}
+
+		// UIや地形など、画面全体やタイルマップの作成で単独で使用するテクスチャは、アトラスに詰め込まずに対応するIDに保存
+		std::unordered_map<ResID, std::string> path_texture_pool;
+		path_texture_pool[ResID::Tex_Tileset] = "resources/tileset.png";
+		path_texture_pool[ResID::Tex_Home] = "resources/home.png";
+
+		path_texture_pool[ResID::Tex_UISelectCursor] = "resources/ui_select_cursor.png";
+		path_texture_pool[ResID::Tex_UIPlaceIdle] = "resources/ui_place_idle.png";
+		path_texture_pool[ResID::Tex_UIPlaceHoveredTop] = "resources/ui_place_hovered_top.png";
+		path_texture_pool[ResID::Tex_UIPlaceHoveredLeft] = "resources/ui_place_hovered_left.png";
+		path_texture_pool[ResID::Tex_UIPlaceHoveredRight] = "resources/ui_place_hovered_right.png";
+		path_texture_pool[ResID::Tex_UIUpgradeIdle] = "resources/ui_upgrade_idle.png";
+		path_texture_pool[ResID::Tex_UIUpgradeHoveredTop] = "resources/ui_upgrade_hovered_top.png";
+		path_texture_pool[ResID::Tex_UIUpgradeHoveredLeft] = "resources/ui_upgrade_hovered_left.png";
+		path_texture_pool[ResID::Tex_UIUpgradeHoveredRight] = "resources/ui_upgrade_hovered_right.png";
+		path_texture_pool[ResID::Tex_UIHomeAvatar] = "resources/ui_home_avatar.png";
+		path_texture_pool[ResID::Tex_UIPlayerAvatar] = "resources/ui_player_avatar.png";
+		path_texture_pool[ResID::Tex_UIHeart] = "resources/ui_heart.png";
+		path_texture_pool[ResID::Tex_UICoin] = "resources/ui_coin.png";
+		path_texture_pool[ResID::Tex_UIGameOverBar] = "resources/ui_game_over_bar.png";
+		path_texture_pool[ResID::Tex_UIWinText] = "resources/ui_win_text.png";
+		path_texture_pool[ResID::Tex_UILossText] = "resources/ui_loss_text.png";
+
+		// 効果音
+		std::unordered_map<ResID, std::string> path_sound_pool;
+		path_sound_pool[ResID::Sound_ArrowFire_1] = "resources/sound_arrow_fire_1.mp3";
+		path_sound_pool[ResID::Sound_ArrowFire_2] = "resources/sound_arrow_fire_2.mp3";
+		path_sound_pool[ResID::Sound_AxeFire] = "resources/sound_axe_fire.wav";
+		path_sound_pool[ResID::Sound_ShellFire] = "resources/sound_shell_fire.wav";
+		path_sound_pool[ResID::Sound_ArrowHit_1] = "resources/sound_arrow_hit_1.mp3";
+		path_sound_pool[ResID::Sound_ArrowHit_2] = "resources/sound_arrow_hit_2.mp3";
+		path_sound_pool[ResID::Sound_ArrowHit_3] = "resources/sound_arrow_hit_3.mp3";
+		path_sound_pool[ResID::Sound_AxeHit_1] = "resources/sound_axe_hit_1.mp3";
+		path_sound_pool[ResID::Sound_AxeHit_2] = "resources/sound_axe_hit_2.mp3";
+		path_sound_pool[ResID::Sound_AxeHit_3] = "resources/sound_axe_hit_3.mp3";
+		path_sound_pool[ResID::Sound_ShellHit] = "resources/sound_shell_hit.mp3";
+
+		path_sound_pool[ResID::Sound_Flash] = "resources/sound_flash.wav";
+		path_sound_pool[ResID::Sound_Impact] = "resources/sound_impact.wav";
+
+		path_sound_pool[ResID::Sound_Coin] = "resources/sound_coin.mp3";
+		path_sound_pool[ResID::Sound_HomeHurt] = "resources/sound_home_hurt.wav";
+		path_sound_pool[ResID::Sound_PlaceTower] = "resources/sound_place_tower.mp3";
+		path_sound_pool[ResID::Sound_TowerLevelUp] = "resources/sound_tower_level_up.mp3";
+
+		path_sound_pool[ResID::Sound_Win] = "resources/sound_win.wav";
+		path_sound_pool[ResID::Sound_Loss] = "resources/sound_loss.mp3";
+
+		// 詰め込んだ結果がキャッシュされている場合はアトラスの画像のデコードを省略する
+		const bool is_atlas_cached = atlas.load_cache(renderer, path_atlas_list, "resources/atlas_cache");
+
+		// デコードする画像と効果音のリストを作成
+		std::vector<DecodeJob> job_list;
+		if (!is_atlas_cached)
+		{
+			for (const std::string &path : path_atlas_list)
+				job_list.push_back({DecodeJob::Type::Image, ResID::Tex_Tileset, path});
+		}
+		const size_t idx_job_texture = job_list.size();
+		for (const auto &pair : path_texture_pool)
+			job_list.push_back({DecodeJob::Type::Image, pair.first, pair.second});
+		const size_t idx_job_sound = job_list.size();
+		for (const auto &pair : path_sound_pool)
+			job_list.push_back({DecodeJob::Type::Sound, pair.first, pair.second});
+
+		// 進捗はデコードとテクスチャの作成（アトラスは1回）の段階数で計算する
+		const size_t num_step = job_list.size() + path_texture_pool.size() + (is_atlas_cached ? 0 : 1);
+		size_t num_step_done = 0;
+		auto advance_progress = [&](size_t num)
+		{
+			num_step_done += num;
+			if (on_progress)
+				on_progress((double)num_step_done / num_step);
+		};
+
+		DecodeCache::AudioSpec spec_audio;
+		Mix_QuerySpec(&spec_audio.frequency, &spec_audio.format, &spec_audio.channels);
+		const DecodeCache decode_cache("resources/decode_cache", spec_audio);
+
+		decode_parallel(job_list, decode_cache, advance_progress);
+
+		// メインスレッドでアトラスとテクスチャを作成（デコード済みのサーフェスはここで解放）
+		bool is_loaded = true;
+		if (!is_atlas_cached)
+		{
+			std::vector<SDL_Surface *> surface_list;
+			for (size_t i = 0; i < idx_job_texture; i++)
+				surface_list.push_back(job_list[i].surface);
+			is_loaded = atlas.pack(renderer, path_atlas_list, surface_list, "resources/atlas_cache");
+			advance_progress(1);
+		}
+
+		for (size_t i = idx_job_texture; i < idx_job_sound; i++)
+		{
+			DecodeJob &job = job_list[i];
+			texture_pool[job.id] = job.surface ? SDL_CreateTextureFromSurface(renderer, job.surface) : nullptr;
+			advance_progress(1);
+		}
+
+		for (size_t i = idx_job_sound; i < job_list.size(); i++)
+			sound_pool[job_list[i].id] = job_list[i].chunk;
+
+		for (DecodeJob &job : job_list)
+			SDL_FreeSurface(job.surface);
+
+		if (!is_loaded)
+			return false;
 
 		// テクスチャの読み込みが完了したら、各テクスチャの読み込みを確認し、失敗した場合はfalseを返す
 		for (const auto &pair : texture_pool)
@@ -182,38 +284,15 @@ public:
 				return false; // texture_poolのデータ構造がハッシュテーブルであることに注意、secondが値に対応
 		}
 
-		// Load_WAVを使用して効果音を読み込む
-		sound_pool[ResID::Sound_ArrowFire_1] = Mix_LoadWAV("resources/sound_arrow_fire_1.mp3");
-		sound_pool[ResID::Sound_ArrowFire_2] = Mix_LoadWAV("resources/sound_arrow_fire_2.mp3");
-		sound_pool[ResID::Sound_AxeFire] = Mix_LoadWAV("resources/sound_axe_fire.wav");
-		sound_pool[ResID::Sound_ShellFire] = Mix_LoadWAV("resources/sound_shell_fire.wav");
-		sound_pool[ResID::Sound_ArrowHit_1] = Mix_LoadWAV("resources/sound_arrow_hit_1.mp3");
-		sound_pool[ResID::Sound_ArrowHit_2] = Mix_LoadWAV("resources/sound_arrow_hit_2.mp3");
-		sound_pool[ResID::Sound_ArrowHit_3] = Mix_LoadWAV("resources/sound_arrow_hit_3.mp3");
-		sound_pool[ResID::Sound_AxeHit_1] = Mix_LoadWAV("resources/sound_axe_hit_1.mp3");
-		sound_pool[ResID::Sound_AxeHit_2] = Mix_LoadWAV("resources/sound_axe_hit_2.mp3");
-		sound_pool[ResID::Sound_AxeHit_3] = Mix_LoadWAV("resources/sound_axe_hit_3.mp3");
-		sound_pool[ResID::Sound_ShellHit] = Mix_LoadWAV("resources/sound_shell_hit.mp3");
-
-		sound_pool[ResID::Sound_Flash] = Mix_LoadWAV("resources/sound_flash.wav");
-		sound_pool[ResID::Sound_Impact] = Mix_LoadWAV("resources/sound_impact.wav");
-
-		sound_pool[ResID::Sound_Coin] = Mix_LoadWAV("resources/sound_coin.mp3");
-		sound_pool[ResID::Sound_HomeHurt] = Mix_LoadWAV("resources/sound_home_hurt.wav");
-		sound_pool[ResID::Sound_PlaceTower] = Mix_LoadWAV("resources/sound_place_tower.mp3");
-		sound_pool[ResID::Sound_TowerLevelUp] = Mix_LoadWAV("resources/sound_tower_level_up.mp3");
-
-		sound_pool[ResID::Sound_Win] = Mix_LoadWAV("resources/sound_win.wav");
-		sound_pool[ResID::Sound_Loss] = Mix_LoadWAV("resources/sound_loss.mp3");
-
 		for (const auto &pair : sound_pool)
 		{
 			if (!pair.second)
 				return false;
 		}
 
-		// LoadMUSを使用してバックグラウンドミュージックを読み込む
-		music_pool[ResID::Music_BGM] = Mix_LoadMUS("resources/music_bgm.mp3");
+		// LoadMUSを使用してバックグラウンドミュージックを読み込む（ストリーミング再生のため、ファイルを開くのみ）
+		const ArchiveManager *archive = ArchiveManager::instance();
+		music_pool[ResID::Music_BGM] = Mix_LoadMUS_RW(archive->open_rw("resources/music_bgm.mp3"), 1);
 
 		for (const auto &pair : music_pool)
 		{
@@ -222,7 +301,8 @@ public:
 		}
 
 		// TTF_OpenFontを使用してフォントを読み込む
-		font_pool[ResID::Font_Main] = TTF_OpenFont("resources/ipix.ttf", 25);
+		font_pool[ResID::Font_Main] = TTF_OpenFontRW(archive->open_rw("resources/ipix.ttf"), 1, 25);
+		font_pool[ResID::Font_Small] = TTF_OpenFontRW(archive->open_rw("resources/ipix.ttf"), 1, 14);
 
 		for (const auto &pair : font_pool)
 		{
@@ -230,6 +310,13 @@ public:
 				return false;
 		}
 
+		// UIのテキストは毎フレーム文字列からテクスチャを作成せず、グリフアトラスから組み立てて描画する
+		for (const auto &pair : font_pool)
+		{
+			if (!glyph_atlas_pool[pair.first].init(renderer, pair.second))
+				return false;
+		}
+
 		return true;
 	}
 
@@ -251,15 +338,132 @@ public:
 		return texture_pool;
 	}
 
+	/*テクスチャを取得、読み込まれていない場合（ヘッドレスモードなど）やアトラスに詰め込んだスプライトの場合はnullptrを返す*/
+	SDL_Texture *find_texture(ResID id) const
+	{
+		const auto &itor = texture_pool.find(id);
+		return itor == texture_pool.end() ? nullptr : itor->second;
+	}
+
+	/*アトラスに詰め込んだスプライトのテクスチャと矩形を取得、読み込まれていない場合は texture が nullptr*/
+	TextureRegion find_region(ResID id) const
+	{
+		const auto &itor = sprite_path_pool.find(id);
+		return itor == sprite_path_pool.end() ? TextureRegion() : atlas.find_region(itor->second);
+	}
+
+	/*パスを指定して（設定ファイルで指定する敵のテクスチャなど）アトラス上のテクスチャと矩形を取得*/
+	TextureRegion find_region(const std::string &path) const
+	{
+		return atlas.find_region(path);
+	}
+
+	/*フォントのグリフアトラスを取得、読み込まれていない場合（ヘッドレスモードなど）はnullptrを返す*/
+	const GlyphAtlas *find_glyph_atlas(ResID id) const
+	{
+		const auto &itor = glyph_atlas_pool.find(id);
+		return itor == glyph_atlas_pool.end() ? nullptr : &itor->second;
+	}
+
+	/*効果音を再生、読み込まれていない場合（ヘッドレスモードなど）は何もしない*/
+	void play_sound(ResID id) const
+	{
+		const auto &itor = sound_pool.find(id);
+		if (itor == sound_pool.end())
+			return;
+
+		Mix_PlayChannel(-1, itor->second, 0);
+	}
+
 protected:
 	ResourcesManager() = default;
 	~ResourcesManager() = default;
 
+private:
+	// ワーカースレッドでデコードする画像（サーフェス）または効果音
+	struct DecodeJob
+	{
+		enum class Type
+		{
+			Image,
+			Sound
+		};
+
+		Type type = Type::Image;
+		ResID id = ResID::Tex_Tileset; // 保存先のID（アトラスの画像の場合は使用しない）
+		std::string path;
+		SDL_Surface *surface = nullptr;
+		Mix_Chunk *chunk = nullptr;
+	};
+
+	// ジョブをワーカースレッドで並列にデコード（キャッシュがあれば読み込み）し、完了したジョブの数をメインスレッドで on_decoded に通知
+	// （画像のデコードは並列に行い、スレッドセーフ性が保証されていない効果音のデコードは DecodeCache 内で排他制御する）
+	static void decode_parallel(std::vector<DecodeJob> &job_list, const DecodeCache &decode_cache, const std::function<void(size_t num)> &on_decoded)
+	{
+		if (job_list.empty())
+			return;
+
+		// ArchiveManager はスレッドごとのインスタンスのため、メインスレッドのインスタンスを渡す
+		const ArchiveManager *archive = ArchiveManager::instance();
+
+		std::atomic<size_t> idx_next(0);
+		std::mutex mutex;
+		std::condition_variable cond_decoded;
+		size_t num_decoded = 0;
+
+		const size_t num_thread = std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), job_list.size());
+		std::vector<std::thread> worker_list;
+		for (size_t i = 0; i < num_thread; i++)
+		{
+			worker_list.emplace_back([&]()
+									 {
+				size_t idx_job;
+				while ((idx_job = idx_next++) < job_list.size())
+				{
+					DecodeJob &job = job_list[idx_job];
+					std::string buffer;
+					const uint8_t *data = nullptr;
+					size_t size = 0;
+					if (archive->load_data(job.path, buffer, data, size))
+					{
+						if (job.type == DecodeJob::Type::Image)
+							job.surface = decode_cache.load_image(data, size);
+						else
+							job.chunk = decode_cache.load_sound(data, size);
+					}
+
+					std::lock_guard<std::mutex> lock(mutex);
+					num_decoded++;
+					cond_decoded.notify_one();
+				} });
+		}
+
+		// メインスレッドはデコードの完了を待ちながら進捗を通知する
+		size_t num_notified = 0;
+		while (num_notified < job_list.size())
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			cond_decoded.wait(lock, [&]()
+							  { return num_decoded > num_notified; });
+			const size_t num = num_decoded - num_notified;
+			num_notified = num_decoded;
+			lock.unlock();
+
+			on_decoded(num);
+		}
+
+		for (std::thread &worker : worker_list)
+			worker.join();
+	}
+
 private:
 	FontPool font_pool;
 	SoundPool sound_pool;
 	MusicPool music_pool;
 	TexturePool texture_pool;
+	SpritePathPool sprite_path_pool;
+	TextureAtlas atlas; // ゲームワールドのスプライトを詰め込んだテクスチャアトラス
+	GlyphAtlasPool glyph_atlas_pool;
 };
 
 #endif // !_RESOURCES_MANAGER_H_
@@ -5,6 +5,7 @@
 
 #include <SDL.h>
 #include <vector>
+#include <utility>
 
 class Route
 {
@@ -15,31 +16,39 @@ public:
 public:
 	Route() = default;
 
+	// コンストラクタ：探索済みの経路点リストを受け取る（コンパイル済みレベルから読み込む場合）
+	explicit Route(IdxList idx_list) : idx_list(std::move(idx_list)) {}
+
 	// コンストラクタ：マップと開始点を受け取り、経路を計算
 	Route(const TileMap &map, const SDL_Point &idx_origin)
 	{
 		// マップの幅と高さを取得し、開始経路点を定義
-		size_t width_map = map[0].size();
-		size_t height_map = map.size();
+		size_t width_map = map.get_width();
+		size_t height_map = map.get_height();
 		SDL_Point idx_next = idx_origin;
 
+		// 通過済みのタイル（1タイル1ビット、大きなマップでも経路点の重複を定数時間でチェック）
+		std::vector<bool> is_visited_list(width_map * height_map, false);
+
 		// マップを巡回し、経路点の終点を見つけるか、進行不可能になるまでループ
 		while (true)
 		{
 			// マップの境界を超えているかチェック
-			if (idx_next.x >= width_map || idx_next.y >= height_map)
+			if ((size_t)idx_next.x >= width_map || (size_t)idx_next.y >= height_map)
 				break;
 
 			// 重複経路が存在するかチェック
-			if (check_duplicate_idx(idx_next))
+			const size_t idx_visited = (size_t)idx_next.y * width_map + idx_next.x;
+			if (is_visited_list[idx_visited])
 				break;
-			else
-				// 現在の点を経路に追加
-				idx_list.push_back(idx_next);
+
+			// 現在の点を経路に追加
+			is_visited_list[idx_visited] = true;
+			idx_list.push_back(idx_next);
 
 			// 現在のTile情報を取得
 			bool is_next_dir_exist = true; // 次の方向が存在するかを示すフラグ
-			const Tile &tile = map[idx_next.y][idx_next.x];
+			const Tile &tile = map.get_tile(idx_next.x, idx_next.y);
 
 			// 現在の点が防御点の場合、経路探索を停止
 			if (tile.special_flag == 0)
@@ -79,19 +88,5 @@ public:
 
 private:
 	IdxList idx_list;
-
-private:
-	// 現在の点が経路内に既に存在するかをチェック（重複を避けるため）
-	bool check_duplicate_idx(const SDL_Point &target_idx)
-	{
-		// 既存の経路点を巡回し、目標点と重複しているかチェック
-		for (const SDL_Point &idx : idx_list)
-		{
-			// x座標が同じで、y座標も一致する場合、経路点が重複
-			if (idx.x == target_idx.x && idx.y == target_idx.y)
-				return true;
-		}
-		return false;
-	};
 };
 #endif // !_ROUTE_H_
@@ -7,50 +7,66 @@
 class ShellBullet : public Bullet
 {
 public:
+	// アニメーションクリップは BulletManager が create_clip() / create_clip_explode() で作成し、オブジェクトプールから取り出すたびに設定する
 	ShellBullet()
 	{
-		// 弾丸のテクスチャを取得
-		static SDL_Texture *tex_shell = ResourcesManager::instance()
-											->get_texture_pool()
-											.find(ResID::Tex_BulletShell)
-											->second;
-
-		// 爆発エフェクトのテクスチャを取得
-		static SDL_Texture *tex_explode = ResourcesManager::instance()
-											  ->get_texture_pool()
-											  .find(ResID::Tex_EffectExplode)
-											  ->second;
-
-		// アニメーションインデックスを設定（2フレーム）
-		static const std::vector<int> idx_list = {0, 1};				  // 弾丸アニメーションフレーム
-		static const std::vector<int> idx_explode_list = {0, 1, 2, 3, 4}; // 爆発アニメーションフレーム
-
-		// アニメーションのループ、間隔、フレームデータを設定
-		// 砲弾
-		animation.set_loop(true);
-		animation.set_interval(0.1);
-		animation.set_frame_data(tex_shell, 2, 1, idx_list);
-
-		// 爆発
-		animation_explode.set_loop(false);
-		animation_explode.set_interval(0.1);
-		animation_explode.set_frame_data(tex_explode, 5, 1, idx_list);
-		animation_explode.set_on_finished(
-			[&]() // 爆発アニメーション終了時のコールバック関数
-			{
-				make_invalid(); // 弾丸を無効にする
-			});
-
 		// 回転不可に設定
 		can_rotate = false;
 		// ダメージ範囲を設定
 		damage_range = 96;
+		// 種類を設定
+		type = BulletType::Shell;
 		// サイズを設定
 		size.x = 48, size.y = 48;
 	};
 
 	~ShellBullet() = default;
 
+	// 砲弾のアニメーションクリップを作成（ゲームワールドごとに一度だけ BulletManager が呼び出し、すべての砲弾で共有）
+	static AnimationClip create_clip()
+	{
+		// 弾丸のテクスチャ（アトラス上の矩形）を取得
+		const TextureRegion region_shell = ResourcesManager::instance()->find_region(ResID::Tex_BulletShell);
+
+		// アニメーションインデックスを設定（2フレーム）
+		static const std::vector<int> idx_list = {0, 1};
+
+		AnimationClip clip;
+		clip.set_loop(true);
+		clip.set_interval(0.1);
+		clip.set_frame_data(region_shell, 2, 1, idx_list);
+		return clip;
+	}
+
+	// 爆発エフェクトのアニメーションクリップを作成（同上）
+	static AnimationClip create_clip_explode()
+	{
+		// 爆発エフェクトのテクスチャ（アトラス上の矩形）を取得
+		const TextureRegion region_explode = ResourcesManager::instance()->find_region(ResID::Tex_EffectExplode);
+
+		// アニメーションインデックスを設定
+		static const std::vector<int> idx_list = {0, 1};				  // 弾丸アニメーションフレーム
+		static const std::vector<int> idx_explode_list = {0, 1, 2, 3, 4}; // 爆発アニメーションフレーム
+
+		AnimationClip clip;
+		clip.set_loop(false);
+		clip.set_interval(0.1);
+		clip.set_frame_data(region_explode, 5, 1, idx_list);
+		return clip;
+	}
+
+	// 爆発エフェクトのアニメーションクリップを設定
+	void set_clip_explode(const AnimationClip *clip)
+	{
+		animation_explode.play(clip);
+	}
+
+	void reset() override
+	{
+		Bullet::reset();
+		animation_explode.reset();
+	}
+
 	void on_update(double delta) override
 	{
 		// 弾丸がまだ衝突可能か（爆発していないか）を判断
@@ -63,6 +79,10 @@ public:
 
 		// 爆発している場合、爆発アニメーションを更新
 		animation_explode.on_update(delta);
+
+		// 爆発アニメーションが終了したら弾丸を無効にする
+		if (animation_explode.check_finished())
+			make_invalid();
 	}
 
 	void on_render(SDL_Renderer *renderer) override
@@ -76,22 +96,22 @@ public:
 		}
 
 		// 爆発している場合、爆発アニメーションの位置を計算してレンダリング
-		static SDL_Point point;
+		static thread_local SDL_Point point;
 
 		// 爆発アニメーションのレンダリング位置を計算
 		point.x = (int)(position.x - 96 / 2);
 		point.y = (int)(position.y - 96 / 2);
 
 		// 爆発アニメーションをレンダリング
-		animation_explode.on_render(renderer, point);
+		animation_explode.on_render(point);
 	};
 
 	void on_collide(Enemy *enemy) override
 	{
 		// 衝突音効を取得して再生
-		static const ResourcesManager::SoundPool &sound_pool = ResourcesManager::instance()->get_sound_pool();
+		const ResourcesManager *resources_manager = ResourcesManager::instance();
 
-		Mix_PlayChannel(-1, sound_pool.find(ResID::Sound_ShellHit)->second, 0);
+		resources_manager->play_sound(ResID::Sound_ShellHit);
 
 		// 衝突を無効にし、爆発状態に移行
 		disable_collide();
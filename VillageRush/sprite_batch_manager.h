@@ -0,0 +1,197 @@
+#ifndef _SPRITE_BATCH_MANAGER_H_
+#define _SPRITE_BATCH_MANAGER_H_
+
+/**
+ * @brief スプライトバッチ管理クラス
+ *
+ * このクラスは、スプライト（テクスチャの矩形）と単色の矩形を四角形の頂点データとして蓄積し、
+ * テクスチャごとにまとめて SDL_RenderGeometry で描画するシングルトンクラスです。
+ * 描画呼び出しの回数がエンティティの数ではなく、テクスチャの種類の数に比例するようにします。
+ *
+ * 主な機能:
+ * - draw() でスプライトを追加（回転角度をサポート、SDL_RenderCopyEx と同じく矩形の中心で回転）
+ * - draw_tinted() で頂点カラーを乗算したスプライトを追加（白色のグリフを着色するテキスト描画などに使用）
+ * - fill_rect() / draw_rect() で単色の塗りつぶし矩形・枠線を追加（テクスチャなしのバッチにまとめる）
+ * - flush() で蓄積した頂点データをテクスチャごとに描画
+ *
+ * 使用方法:
+ * - 各マネージャーの on_render() でエンティティのスプライトを追加し、最後に flush() を呼び出す
+ *   （flush() の単位が描画の層になり、先に flush() したものが下に描画される）
+ *
+ * 注意事項:
+ * - 同じ層の中では、テクスチャごとに最初に追加された順に描画されます（同じテクスチャ内は追加順）
+ * - テクスチャのサイズは層ごとに最初に使用したときに問い合わせ、バッチと一緒に破棄します
+ *   （テクスチャのポインタをキーに保持し続けないため、破棄されたテクスチャと同じアドレスに作成されたテクスチャでも正しいサイズを使用する）
+ */
+
+#include "manager.h"
+#include "profile_manager.h"
+
+#include <SDL.h>
+#include <cmath>
+#include <vector>
+#include <unordered_map>
+
+class SpriteBatchManager : public Manager<SpriteBatchManager>
+{
+	friend class Manager<SpriteBatchManager>;
+
+public:
+	// スプライトを追加（rect_srcがnullptrの場合はテクスチャ全体、angleは度単位で時計回り）
+	void draw(SDL_Texture *texture, const SDL_Rect *rect_src, const SDL_Rect &rect_dst, double angle = 0)
+	{
+		static const SDL_Color color_white = {255, 255, 255, 255};
+
+		add_sprite(texture, rect_src, rect_dst, color_white, angle);
+	}
+
+	// テクスチャの色に color を乗算したスプライトを追加（SDL_SetTextureColorMod と異なり、同じテクスチャでも色ごとに変更できる）
+	void draw_tinted(SDL_Texture *texture, const SDL_Rect *rect_src, const SDL_Rect &rect_dst, const SDL_Color &color)
+	{
+		add_sprite(texture, rect_src, rect_dst, color, 0);
+	}
+
+	// 単色の塗りつぶし矩形を追加
+	void fill_rect(const SDL_Rect &rect, const SDL_Color &color)
+	{
+		add_quad(find_batch(nullptr), rect, color, {0, 0}, {0, 0}, 0);
+	}
+
+	// 単色の枠線（幅1ピクセル、SDL_RenderDrawRect と同じ範囲）を追加
+	void draw_rect(const SDL_Rect &rect, const SDL_Color &color)
+	{
+		if (rect.w <= 0 || rect.h <= 0)
+			return;
+
+		fill_rect({rect.x, rect.y, rect.w, 1}, color);
+		fill_rect({rect.x, rect.y + rect.h - 1, rect.w, 1}, color);
+		if (rect.h > 2)
+		{
+			fill_rect({rect.x, rect.y + 1, 1, rect.h - 2}, color);
+			fill_rect({rect.x + rect.w - 1, rect.y + 1, 1, rect.h - 2}, color);
+		}
+	}
+
+	// 蓄積したすべてのバッチを、テクスチャごとに1回の呼び出しで描画
+	void flush(SDL_Renderer *renderer)
+	{
+		PROFILE_ZONE("SpriteBatchManager::flush");
+
+		for (size_t i = 0; i < num_batch; i++)
+		{
+			Batch &batch = batch_list[i];
+			if (!batch.idx_list.empty())
+			{
+				SDL_RenderGeometry(renderer, batch.texture, batch.vertex_list.data(), (int)batch.vertex_list.size(), batch.idx_list.data(), (int)batch.idx_list.size());
+				num_draw_call++;
+			}
+
+			// 頂点リストの容量は次のフレームで再利用する
+			batch.vertex_list.clear();
+			batch.idx_list.clear();
+		}
+
+		num_batch = 0;
+		idx_batch_map.clear();
+	}
+
+	// reset_num_draw_call() からの描画呼び出しの回数
+	size_t get_num_draw_call() const
+	{
+		return num_draw_call;
+	}
+
+	void reset_num_draw_call()
+	{
+		num_draw_call = 0;
+	}
+
+protected:
+	SpriteBatchManager() = default;
+	~SpriteBatchManager() = default;
+
+private:
+	// テクスチャごとの頂点データ（texture が nullptr の場合は単色の矩形）
+	struct Batch
+	{
+		SDL_Texture *texture = nullptr;
+		SDL_Point size_texture = {0, 0}; // テクスチャのサイズ（バッチの作成時に問い合わせる）
+		std::vector<SDL_Vertex> vertex_list;
+		std::vector<int> idx_list;
+	};
+
+private:
+	std::vector<Batch> batch_list;							 // 現在の層のバッチ（先頭から num_batch 個を使用）
+	size_t num_batch = 0;
+	std::unordered_map<SDL_Texture *, size_t> idx_batch_map; // テクスチャから batch_list の番号への対応
+	size_t num_draw_call = 0;
+
+private:
+	Batch &find_batch(SDL_Texture *texture)
+	{
+		const auto itor = idx_batch_map.find(texture);
+		if (itor != idx_batch_map.end())
+			return batch_list[itor->second];
+
+		if (num_batch == batch_list.size())
+			batch_list.emplace_back();
+
+		Batch &batch = batch_list[num_batch];
+		batch.texture = texture;
+		batch.size_texture = {0, 0};
+		if (texture)
+			SDL_QueryTexture(texture, nullptr, nullptr, &batch.size_texture.x, &batch.size_texture.y);
+		idx_batch_map[texture] = num_batch++;
+		return batch;
+	}
+
+	void add_sprite(SDL_Texture *texture, const SDL_Rect *rect_src, const SDL_Rect &rect_dst, const SDL_Color &color, double angle)
+	{
+		if (!texture)
+			return;
+
+		// テクスチャ座標（0～1）を計算
+		Batch &batch = find_batch(texture);
+		const SDL_Point &size_texture = batch.size_texture;
+		SDL_FPoint uv_min = {0, 0}, uv_max = {1, 1};
+		if (rect_src && size_texture.x > 0 && size_texture.y > 0)
+		{
+			uv_min.x = (float)rect_src->x / size_texture.x, uv_min.y = (float)rect_src->y / size_texture.y;
+			uv_max.x = (float)(rect_src->x + rect_src->w) / size_texture.x, uv_max.y = (float)(rect_src->y + rect_src->h) / size_texture.y;
+		}
+
+		add_quad(batch, rect_dst, color, uv_min, uv_max, angle);
+	}
+
+	// 矩形（中心で angle 度回転）の4頂点と2つの三角形を追加
+	static void add_quad(Batch &batch, const SDL_Rect &rect, const SDL_Color &color, const SDL_FPoint &uv_min, const SDL_FPoint &uv_max, double angle)
+	{
+		const float half_w = rect.w / 2.0f, half_h = rect.h / 2.0f;
+		const float center_x = rect.x + half_w, center_y = rect.y + half_h;
+		const SDL_FPoint offset_list[4] = {{-half_w, -half_h}, {half_w, -half_h}, {half_w, half_h}, {-half_w, half_h}};
+		const SDL_FPoint uv_list[4] = {{uv_min.x, uv_min.y}, {uv_max.x, uv_min.y}, {uv_max.x, uv_max.y}, {uv_min.x, uv_max.y}};
+
+		float cos_angle = 1, sin_angle = 0;
+		if (angle != 0)
+		{
+			const double radian = angle * 3.1415926535 / 180;
+			cos_angle = (float)std::cos(radian), sin_angle = (float)std::sin(radian);
+		}
+
+		const int idx_base = (int)batch.vertex_list.size();
+		for (int i = 0; i < 4; i++)
+		{
+			SDL_Vertex vertex;
+			vertex.position.x = center_x + offset_list[i].x * cos_angle - offset_list[i].y * sin_angle;
+			vertex.position.y = center_y + offset_list[i].x * sin_angle + offset_list[i].y * cos_angle;
+			vertex.color = color;
+			vertex.tex_coord = uv_list[i];
+			batch.vertex_list.push_back(vertex);
+		}
+
+		for (int idx : {0, 1, 2, 0, 2, 3})
+			batch.idx_list.push_back(idx_base + idx);
+	}
+};
+
+#endif // !_SPRITE_BATCH_MANAGER_H_
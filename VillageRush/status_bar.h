@@ -5,10 +5,12 @@
 #include "resources_manager.h"
 #include "home_manager.h"
 #include "player_manager.h"
+#include "profile_manager.h"
+#include "sprite_batch_manager.h"
+#include "primitive_cache_manager.h"
 
 #include <SDL.h>
-#include <string>
-#include <SDL2_gfxPrimitives.h>
+#include <cstdio>
 
 class StatusBar
 {
@@ -24,44 +26,26 @@ public:
 
 	void on_update(SDL_Renderer *renderer)
 	{
-		// メインフォントを取得
-		static TTF_Font *font = ResourcesManager::instance()->get_font_pool().find(ResID::Font_Main)->second;
-
-		// 前のテクスチャを破壊してメモリリークを防ぐ
-		SDL_DestroyTexture(tex_text_background);
-		tex_text_background = nullptr;
-		SDL_DestroyTexture(tex_text_foreground);
-		tex_text_foreground = nullptr;
-
-		// 現在のコイン数量を取得して文字列に変換
-		std::string str_val = std::to_string((int)CoinManager::instance()->get_current_coin_num());
-		// 背景テクスチャを作成
-		SDL_Surface *suf_text_background = TTF_RenderText_Blended(font, str_val.c_str(), color_text_background);
-		// 前景テクスチャを作成
-		SDL_Surface *suf_text_foreground = TTF_RenderText_Blended(font, str_val.c_str(), color_text_foreground);
-		// テキストの幅と高さを設定
-		width_text = suf_text_background->w, height_text = suf_text_background->h;
-
-		// テキストサーフェスをテクスチャに変換
-		tex_text_background = SDL_CreateTextureFromSurface(renderer, suf_text_background);
-		tex_text_foreground = SDL_CreateTextureFromSurface(renderer, suf_text_foreground);
-
-		// テキストサーフェスを解放してメモリリークを防ぐ
-		SDL_FreeSurface(suf_text_background);
-		SDL_FreeSurface(suf_text_foreground);
+		PROFILE_ZONE("StatusBar::on_update");
+
+		// 現在のコイン数量を取得して文字列に変換（テキストは描画時にグリフアトラスから組み立てる）
+		snprintf(str_coin, sizeof(str_coin), "%d", (int)CoinManager::instance()->get_current_coin_num());
 	}
 
 	void on_render(SDL_Renderer *renderer)
 	{
 
-		static SDL_Rect rect_dst; // レンダリング位置とサイズを設定するための矩形
+		static thread_local SDL_Rect rect_dst; // レンダリング位置とサイズを設定するための矩形
 
 		/* テクスチャを取得 */
-		static const ResourcesManager::TexturePool &tex_pool = ResourcesManager::instance()->get_texture_pool();
-		static SDL_Texture *tex_coin = tex_pool.find(ResID::Tex_UICoin)->second;
-		static SDL_Texture *tex_heart = tex_pool.find(ResID::Tex_UIHeart)->second;
-		static SDL_Texture *tex_home_avatar = tex_pool.find(ResID::Tex_UIHomeAvatar)->second;
-		static SDL_Texture *tex_player_avatar = tex_pool.find(ResID::Tex_UIPlayerAvatar)->second;
+		const ResourcesManager::TexturePool &tex_pool = ResourcesManager::instance()->get_texture_pool();
+		SDL_Texture *tex_coin = tex_pool.find(ResID::Tex_UICoin)->second;
+		SDL_Texture *tex_heart = tex_pool.find(ResID::Tex_UIHeart)->second;
+		SDL_Texture *tex_home_avatar = tex_pool.find(ResID::Tex_UIHomeAvatar)->second;
+		SDL_Texture *tex_player_avatar = tex_pool.find(ResID::Tex_UIPlayerAvatar)->second;
+		const GlyphAtlas *glyph_atlas = ResourcesManager::instance()->find_glyph_atlas(ResID::Font_Main);
+		SpriteBatchManager *sprite_batch = SpriteBatchManager::instance();
+		PrimitiveCacheManager *primitive_cache = PrimitiveCacheManager::instance();
 
 		/* メインベースのアバターをレンダリング */
 		rect_dst.x = position.x, rect_dst.y = position.y;
@@ -83,16 +67,11 @@ public:
 		rect_dst.w = 32, rect_dst.h = 32;
 		SDL_RenderCopy(renderer, tex_coin, nullptr, &rect_dst);
 
-		/* バックグラウンドテクスチャ（コイン数量）をレンダリング */
-		rect_dst.x += 32 + 10 + offset_shadow.x;
-		rect_dst.y = rect_dst.y + (32 - height_text) / 2 + offset_shadow.y;
-		rect_dst.w = width_text, rect_dst.h = height_text;
-		SDL_RenderCopy(renderer, tex_text_background, nullptr, &rect_dst);
-
-		/* 前景テクスチャ（コイン数量）をレンダリング */
-		rect_dst.x -= offset_shadow.x;
-		rect_dst.y -= offset_shadow.y;
-		SDL_RenderCopy(renderer, tex_text_foreground, nullptr, &rect_dst);
+		/* コイン数量を影付きでレンダリング */
+		rect_dst.x += 32 + 10;
+		rect_dst.y = rect_dst.y + (32 - glyph_atlas->get_height()) / 2;
+		glyph_atlas->draw_text_shadow(rect_dst.x, rect_dst.y, str_coin, color_text_foreground, color_text_background, offset_shadow);
+		sprite_batch->flush(renderer);
 
 		/* プレイヤーアバターをレンダリング */
 		rect_dst.x = position.x + (78 - 65) / 2;
@@ -100,20 +79,20 @@ public:
 		rect_dst.w = 65, rect_dst.h = 65;
 		SDL_RenderCopy(renderer, tex_player_avatar, nullptr, &rect_dst);
 
-		/* mpバーのバックグラウンドをレンダリング */
+		/* mpバーのバックグラウンドをレンダリング（角丸矩形はキャッシュしたテクスチャを使用、終点を含むため幅と高さは+1） */
 		rect_dst.x = position.x + 78 + 15;
 		rect_dst.y += 10;
-		roundedBoxRGBA(renderer, rect_dst.x, rect_dst.y, rect_dst.x + width_mp_bar, rect_dst.y + height_mp_bar, 4,
-					   color_mp_bar_background.r, color_mp_bar_background.g, color_mp_bar_background.b, color_mp_bar_background.a);
+		rect_dst.w = width_mp_bar + 1, rect_dst.h = height_mp_bar + 1;
+		SDL_RenderCopy(renderer, primitive_cache->find_rounded_box(renderer, width_mp_bar, height_mp_bar, 4, color_mp_bar_background), nullptr, &rect_dst);
 
-		/* mpバーの内容をレンダリング */
+		/* mpバーの内容をレンダリング（幅はピクセル単位で変わるため、幅ごとのテクスチャは最大でもMPバーの内側の幅の数） */
 		rect_dst.x += width_border_mp_bar;
 		rect_dst.y += width_border_mp_bar;
-		rect_dst.w = width_mp_bar - 2 * width_border_mp_bar;
-		rect_dst.h = height_mp_bar - 2 * width_border_mp_bar;
+		const int width_content = width_mp_bar - 2 * width_border_mp_bar;
+		const int height_content = height_mp_bar - 2 * width_border_mp_bar;
 		double process = PlayerManager::instance()->get_current_mp() / 100; // 現在のmp比率
-		roundedBoxRGBA(renderer, rect_dst.x, rect_dst.y, rect_dst.x + (int)(rect_dst.w * process), rect_dst.y + rect_dst.h, 2,
-					   color_mp_bar_foreground.r, color_mp_bar_foreground.g, color_mp_bar_foreground.b, color_mp_bar_foreground.a);
+		rect_dst.w = (int)(width_content * process) + 1, rect_dst.h = height_content + 1;
+		SDL_RenderCopy(renderer, primitive_cache->find_rounded_box(renderer, rect_dst.w - 1, height_content, 2, color_mp_bar_foreground), nullptr, &rect_dst);
 	}
 
 private:
@@ -128,10 +107,8 @@ private:
 	const SDL_Color color_mp_bar_foreground = {144, 121, 173, 255}; // MPバーのフォアグラウンドの色（紫）
 
 private:
-	SDL_Point position = {0};					// ステータスバーの位置
-	int width_text = 0, height_text = 0;		// テキストの幅と高さ
-	SDL_Texture *tex_text_background = nullptr; // テキストのバックグラウンドテクスチャ
-	SDL_Texture *tex_text_foreground = nullptr; // テキストのフォアグラウンドテクスチャ
+	SDL_Point position = {0}; // ステータスバーの位置
+	char str_coin[16] = "0";  // コイン数量のテキスト
 };
 
 #endif // !_STATUS_BAR_H_
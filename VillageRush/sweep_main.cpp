@@ -0,0 +1,62 @@
+#define SDL_MAIN_HANDLED
+#define ALLOC_COUNTER_IMPLEMENTATION // このファイルで operator new を置き換え、ヒープ確保回数を数える（デバッグビルドのみ）
+
+#include "sweep_runner.h"
+
+#include <thread>
+#include <fstream>
+
+// パラメータスイープのエントリーポイント
+// スイープ仕様（JSON）のすべての組み合わせをヘッドレスシミュレーションで並列に実行し、結果をCSV形式で出力する
+// 使用例: village_rush_sweep sweep.json --threads 32 --out result.csv
+// ビルド例（Linux）:
+//   g++ -std=c++17 -O2 -pthread sweep_main.cpp -o village_rush_sweep $(sdl2-config --cflags --libs) -lSDL2_image -lSDL2_mixer -lSDL2_ttf -lSDL2_gfx -lcjson
+int main(int argc, char** argv)
+{
+	std::string path_spec, path_out;
+	int num_thread = (int)std::thread::hardware_concurrency();
+	bool is_valid_args = true;
+
+	// コマンドライン引数の解析
+	for (int i = 1; i < argc; i++)
+	{
+		const std::string arg = argv[i];
+		if (arg == "--threads" && i + 1 < argc)
+			num_thread = std::atoi(argv[++i]);
+		else if (arg == "--out" && i + 1 < argc)
+			path_out = argv[++i];
+		else if (path_spec.empty() && arg.rfind("--", 0) != 0)
+			path_spec = arg;
+		else
+			is_valid_args = false;
+	}
+	if (!is_valid_args || path_spec.empty())
+	{
+		std::cerr << "usage: " << argv[0] << " SPEC.json [--threads N] [--out FILE]" << std::endl;
+		return -1;
+	}
+	if (num_thread <= 0)
+		num_thread = 1;
+
+	SweepRunner sweep_runner;
+	if (!sweep_runner.load_spec(path_spec))
+		return -1;
+
+	std::cerr << sweep_runner.get_num_run() << " runs on " << num_thread << " threads" << std::endl;
+
+	// 結果の出力先（指定がない場合は標準出力）
+	if (path_out.empty())
+	{
+		sweep_runner.run(num_thread, std::cout);
+		return 0;
+	}
+
+	std::ofstream file(path_out);
+	if (!file.good())
+	{
+		std::cerr << u8"出力ファイルを開けません: " << path_out << std::endl;
+		return -1;
+	}
+	sweep_runner.run(num_thread, file);
+	return 0;
+};
@@ -0,0 +1,305 @@
+#ifndef _SWEEP_RUNNER_H_
+#define _SWEEP_RUNNER_H_
+
+/**
+ * @brief パラメータスイープ実行クラス
+ *
+ * このクラスは、設定値の組み合わせごとにヘッドレスシミュレーションを並列に実行し、
+ * 結果をCSV形式で出力します。
+ *
+ * 主な機能:
+ * - スイープ仕様（JSON）の読み込み
+ * - パラメータの値リストとシードのすべての組み合わせの実行
+ * - 複数スレッドでの並列実行（ゲームワールドはスレッドごとに独立）
+ * - 結果のCSV出力
+ *
+ * スイープ仕様の例:
+ * {
+ *   "seeds": [1, 2, 3],
+ *   "max_ticks": 216000,
+ *   "towers": ["archer:3:2", "gunner:1:6@600"],
+ *   "params": {
+ *     "tower.archer.damage": [20, 30, 40],
+ *     "enemy.slim.hp": {"from": 60, "to": 120, "step": 20}
+ *   }
+ * }
+ *
+ * 各マネージャーのインスタンスはスレッドごとに保持されるため、各スレッドは1回の実行ごとに
+ * 新しいワールドを作成し、終了時にすべてのマネージャーを破棄します。
+ */
+
+#include "game_manager.h"
+
+#include <SDL.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cJSON.h>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+
+class SweepRunner
+{
+public:
+	SweepRunner() = default;
+	~SweepRunner() = default;
+
+	// スイープ仕様を読み込み、成功した場合はtrueを返す
+	bool load_spec(const std::string &path)
+	{
+		std::ifstream file(path);
+		if (!file.good())
+		{
+			std::cerr << u8"スイープ仕様を開けません: " << path << std::endl;
+			return false;
+		}
+
+		std::stringstream str_stream;
+		str_stream << file.rdbuf();
+		file.close();
+
+		cJSON *json_root = cJSON_Parse(str_stream.str().c_str());
+		if (!json_root || json_root->type != cJSON_Object)
+		{
+			std::cerr << u8"スイープ仕様の解析に失敗しました" << std::endl;
+			cJSON_Delete(json_root);
+			return false;
+		}
+
+		bool is_valid = parse_spec(json_root);
+		cJSON_Delete(json_root);
+		if (!is_valid)
+			return false;
+
+		// 防御塔の建設指示とパラメータのキーを、実行前に1つのワールドで検証
+		validate_spec(is_valid);
+		return is_valid;
+	}
+
+	// すべての組み合わせをnum_threadスレッドで実行し、結果をCSV形式で出力
+	void run(int num_thread, std::ostream &os)
+	{
+		const size_t num_run = get_num_run();
+		result_list.assign(num_run, Result());
+
+		std::atomic<size_t> idx_next(0);
+		std::atomic<size_t> num_done(0);
+		std::vector<std::thread> worker_list;
+		for (int i = 0; i < num_thread; i++)
+		{
+			worker_list.emplace_back([&]()
+									 {
+				size_t idx_run;
+				while ((idx_run = idx_next++) < num_run)
+				{
+					// 1回の実行ごとにワールドを作成・破棄し、初期状態から始める
+					run_single(idx_run);
+
+					size_t num = ++num_done;
+					if (num % 100 == 0 || num == num_run)
+						std::cerr << "\r" << num << " / " << num_run << std::flush;
+				} });
+		}
+		for (std::thread &worker : worker_list)
+			worker.join();
+		std::cerr << std::endl;
+
+		write_csv(os);
+	}
+
+	// 実行回数（パラメータの組み合わせ数 × シード数）を取得
+	size_t get_num_run() const
+	{
+		size_t num_run = seed_list.size();
+		for (const Param &param : param_list)
+			num_run *= param.val_list.size();
+		return num_run;
+	}
+
+private:
+	// スイープ対象のパラメータ
+	struct Param
+	{
+		std::string key;			 // 設定ファイルのキーパス
+		std::vector<double> val_list; // 試行する値のリスト
+	};
+
+	// 1回の実行結果
+	struct Result
+	{
+		const char *str_result = "";
+		double hp = 0;
+		double coin = 0;
+		Uint64 ticks = 0;
+	};
+
+private:
+	std::vector<uint32_t> seed_list = {0};
+	Uint64 max_ticks = 0; // 0の場合は刻みレート × 1時間分
+	std::vector<std::string> build_order_list;
+	std::vector<Param> param_list;
+
+	std::vector<Result> result_list;
+
+private:
+	bool parse_spec(cJSON *json_root)
+	{
+		cJSON *json_seeds = cJSON_GetObjectItem(json_root, "seeds");
+		if (json_seeds && json_seeds->type == cJSON_Array)
+		{
+			seed_list.clear();
+			cJSON *json_seed = nullptr;
+			cJSON_ArrayForEach(json_seed, json_seeds)
+			{
+				if (json_seed->type == cJSON_Number)
+					seed_list.push_back((uint32_t)json_seed->valuedouble);
+			}
+			if (seed_list.empty())
+			{
+				std::cerr << u8"シードリストが空です" << std::endl;
+				return false;
+			}
+		}
+
+		cJSON *json_max_ticks = cJSON_GetObjectItem(json_root, "max_ticks");
+		if (json_max_ticks && json_max_ticks->type == cJSON_Number && json_max_ticks->valuedouble > 0)
+			max_ticks = (Uint64)json_max_ticks->valuedouble;
+
+		cJSON *json_towers = cJSON_GetObjectItem(json_root, "towers");
+		if (json_towers && json_towers->type == cJSON_Array)
+		{
+			cJSON *json_tower = nullptr;
+			cJSON_ArrayForEach(json_tower, json_towers)
+			{
+				if (json_tower->type == cJSON_String)
+					build_order_list.push_back(json_tower->valuestring);
+			}
+		}
+
+		cJSON *json_params = cJSON_GetObjectItem(json_root, "params");
+		if (json_params && json_params->type == cJSON_Object)
+		{
+			cJSON *json_param = nullptr;
+			cJSON_ArrayForEach(json_param, json_params)
+			{
+				param_list.emplace_back();
+				Param &param = param_list.back();
+				param.key = json_param->string;
+
+				// 値のリスト、または範囲指定（from・to・step）を解析
+				if (json_param->type == cJSON_Array)
+				{
+					cJSON *json_val = nullptr;
+					cJSON_ArrayForEach(json_val, json_param)
+					{
+						if (json_val->type == cJSON_Number)
+							param.val_list.push_back(json_val->valuedouble);
+					}
+				}
+				else if (json_param->type == cJSON_Object)
+				{
+					cJSON *json_from = cJSON_GetObjectItem(json_param, "from");
+					cJSON *json_to = cJSON_GetObjectItem(json_param, "to");
+					cJSON *json_step = cJSON_GetObjectItem(json_param, "step");
+					if (json_from && json_to && json_step && json_from->type == cJSON_Number && json_to->type == cJSON_Number && json_step->type == cJSON_Number && json_step->valuedouble > 0)
+					{
+						// 浮動小数点の誤差で終端の値が抜けないように、値の個数を先に求める
+						const double from = json_from->valuedouble, step = json_step->valuedouble;
+						const int num_val = (int)((json_to->valuedouble - from) / step + 1e-9) + 1;
+						for (int i = 0; i < num_val; i++)
+							param.val_list.push_back(from + step * i);
+					}
+				}
+
+				if (param.val_list.empty())
+				{
+					std::cerr << u8"パラメータの値が不正です: " << param.key << std::endl;
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	// 建設指示とパラメータのキーが有効かどうかを検証（検証用のワールドは終了時に破棄）
+	void validate_spec(bool &is_valid)
+	{
+		GameManager *game = GameManager::create_headless_world();
+
+		for (const std::string &str : build_order_list)
+		{
+			if (!game->parse_build_order(str))
+			{
+				std::cerr << u8"防御塔の建設指示が不正です: " << str << std::endl;
+				is_valid = false;
+			}
+		}
+		for (const Param &param : param_list)
+		{
+			if (!ConfigManager::instance()->set_config_value(param.key, param.val_list[0]))
+			{
+				std::cerr << u8"パラメータのキーが不正です: " << param.key << std::endl;
+				is_valid = false;
+			}
+		}
+
+		GameManager::destroy_world();
+	}
+
+	// idx_run番目の組み合わせを現在のスレッドのワールドで実行（終了時にワールドを破棄）
+	void run_single(size_t idx_run)
+	{
+		GameManager *game = GameManager::create_headless_world();
+		ConfigManager *config = ConfigManager::instance();
+
+		// 実行番号をシードとパラメータ値のインデックスに分解
+		size_t idx = idx_run;
+		RandomManager::instance()->set_seed(seed_list[idx % seed_list.size()]);
+		idx /= seed_list.size();
+		for (const Param &param : param_list)
+		{
+			config->set_config_value(param.key, param.val_list[idx % param.val_list.size()]);
+			idx /= param.val_list.size();
+		}
+
+		for (const std::string &str : build_order_list)
+			game->parse_build_order(str);
+
+		Result &result = result_list[idx_run];
+		result.str_result = game->simulate(max_ticks > 0 ? max_ticks : (Uint64)config->basic_template.tick_rate * 60 * 60);
+		result.hp = HomeManager::instance()->get_current_hp_num();
+		result.coin = CoinManager::instance()->get_current_coin_num();
+		result.ticks = game->get_tick();
+
+		GameManager::destroy_world();
+	}
+
+	void write_csv(std::ostream &os) const
+	{
+		os << "run,seed";
+		for (const Param &param : param_list)
+			os << "," << param.key;
+		os << ",result,hp,coin,ticks" << std::endl;
+
+		for (size_t idx_run = 0; idx_run < result_list.size(); idx_run++)
+		{
+			size_t idx = idx_run;
+			os << idx_run << "," << seed_list[idx % seed_list.size()];
+			idx /= seed_list.size();
+			for (const Param &param : param_list)
+			{
+				os << "," << param.val_list[idx % param.val_list.size()];
+				idx /= param.val_list.size();
+			}
+
+			const Result &result = result_list[idx_run];
+			os << "," << result.str_result << "," << result.hp << "," << result.coin << "," << result.ticks << "\n";
+		}
+		os.flush();
+	}
+};
+
+#endif // !_SWEEP_RUNNER_H_
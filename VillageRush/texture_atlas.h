@@ -0,0 +1,315 @@
+#ifndef _TEXTURE_ATLAS_H_
+#define _TEXTURE_ATLAS_H_
+
+/**
+ * @brief テクスチャアトラスクラス
+ *
+ * このクラスは、複数の画像ファイルを1枚（入りきらない場合は数枚）の大きなテクスチャ（ページ）に詰め込み、
+ * 各画像をページ上の矩形（TextureRegion）として参照できるようにします。
+ * 同じページの画像は同じテクスチャになるため、スプライトバッチで1回の描画呼び出しにまとめられます。
+ *
+ * 主な機能:
+ * - 画像を高さの順に並べ、行（シェルフ）単位で左から詰め込む
+ * - 詰め込んだページ（展開済みの画素、DecodeCache の画像形式）と配置情報をキャッシュディレクトリに保存し、
+ *   次回以降の起動では画像の展開なしに読み込むだけで済ませる
+ * - 元の画像ファイルのサイズと更新日時（アーカイブ内の画像の場合はサイズとチェックサム）が変わった場合はキャッシュを無効とし、詰め込み直す
+ *
+ * 使用方法:
+ * - load_cache() に画像ファイルのパスリストとキャッシュディレクトリを渡し、有効なキャッシュがあれば読み込む
+ * - キャッシュがない場合は、画像を読み込んだサーフェスのリストを pack() に渡して詰め込む（画像の読み込みは呼び出し側で並列に行える）
+ * - find_region(path) で画像のページテクスチャと矩形を取得
+ *
+ * 注意事項:
+ * - 画像同士の間には1ピクセルの余白を入れ、拡大縮小時に隣の画像の色が混ざらないようにします
+ * - ページの最大サイズ（max_size_page）より大きい画像は詰め込めないため、読み込みに失敗します
+ */
+
+#include "texture_region.h"
+#include "archive_manager.h"
+#include "decode_cache.h"
+
+#include <SDL.h>
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+#include <filesystem>
+#include <unordered_map>
+
+class TextureAtlas
+{
+public:
+	TextureAtlas() = default;
+
+	// ページのテクスチャは他のテクスチャと同じくレンダラーと共に解放される
+	~TextureAtlas()
+	{
+		for (SDL_Surface *surface_page : surface_page_list)
+			SDL_FreeSurface(surface_page);
+	}
+
+	TextureAtlas(const TextureAtlas &) = delete;
+	TextureAtlas &operator=(const TextureAtlas &) = delete;
+
+	// キャッシュの配置情報を読み込み、すべての画像の配置があり更新されていない場合のみページを読み込む
+	// 配置情報の形式：1行目に "atlas <形式のバージョン> <ページ数>"、以降は1行に1画像 "<パス> <スタンプ> <ページ> <x> <y> <w> <h>"
+	bool load_cache(SDL_Renderer *renderer, const std::vector<std::string> &path_list, const std::string &dir_cache)
+	{
+		std::ifstream file(dir_cache + "/atlas.txt");
+		if (!file.good())
+			return false;
+
+		std::string str_header;
+		int version = 0, num_page = 0;
+		if (!(file >> str_header >> version >> num_page) || str_header != "atlas" || version != version_cache || num_page <= 0)
+			return false;
+
+		std::unordered_map<std::string, std::string> stamp_pool;
+		std::string path, stamp;
+		Placement placement;
+		while (file >> path >> stamp >> placement.idx_page >> placement.rect.x >> placement.rect.y >> placement.rect.w >> placement.rect.h)
+		{
+			if (placement.idx_page < 0 || placement.idx_page >= num_page)
+				return false;
+			region_pool[path] = placement;
+			stamp_pool[path] = stamp;
+		}
+
+		// 画像の構成が変わった場合や、画像が更新された場合は無効
+		bool is_valid = region_pool.size() == path_list.size();
+		for (size_t i = 0; i < path_list.size() && is_valid; i++)
+		{
+			const auto &itor = stamp_pool.find(path_list[i]);
+			is_valid = itor != stamp_pool.end() && itor->second == get_stamp(path_list[i]);
+		}
+
+		for (int i = 0; i < num_page && is_valid; i++)
+		{
+			SDL_Surface *surface_page = DecodeCache::read_image(dir_cache + "/atlas_" + std::to_string(i) + ".img", 0);
+			SDL_Texture *texture = surface_page ? SDL_CreateTextureFromSurface(renderer, surface_page) : nullptr;
+			SDL_FreeSurface(surface_page);
+			is_valid = texture != nullptr;
+			if (texture)
+			{
+				SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+				page_list.push_back(texture);
+			}
+		}
+
+		if (!is_valid)
+		{
+			for (SDL_Texture *texture : page_list)
+				SDL_DestroyTexture(texture);
+			page_list.clear();
+			region_pool.clear();
+		}
+
+		return is_valid;
+	}
+
+	// 読み込み済みの画像（path_list と同じ順のサーフェス）を詰め込んでテクスチャを作成し、キャッシュに保存
+	// （サーフェスは呼び出し側で解放する）
+	bool pack(SDL_Renderer *renderer, const std::vector<std::string> &path_list, const std::vector<SDL_Surface *> &surface_list, const std::string &dir_cache)
+	{
+		// 画像の両側に余白を入れるため、余白を含めてページに入りきらない画像は扱えない
+		for (const SDL_Surface *surface : surface_list)
+		{
+			if (!surface || surface->w + 2 * padding > max_size_page || surface->h + 2 * padding > max_size_page)
+				return false;
+		}
+
+		if (!place(path_list, surface_list) || !blit_page(renderer, path_list, surface_list))
+			return false;
+
+		save_cache(dir_cache); // キャッシュの保存に失敗しても、アトラス自体は使用できる
+		return true;
+	}
+
+	// パスを指定して画像の矩形を取得（アトラスに含まれない場合は texture が nullptr）
+	TextureRegion find_region(const std::string &path) const
+	{
+		const auto &itor = region_pool.find(path);
+		if (itor == region_pool.end())
+			return TextureRegion();
+
+		TextureRegion region;
+		region.texture = page_list[itor->second.idx_page];
+		region.rect = itor->second.rect;
+		return region;
+	}
+
+	bool check_contains(const std::string &path) const
+	{
+		return region_pool.count(path) > 0;
+	}
+
+	size_t get_num_page() const
+	{
+		return page_list.size();
+	}
+
+private:
+	static constexpr int max_size_page = 2048; // ページの最大の幅と高さ
+	static constexpr int padding = 1;		   // 画像同士の余白
+	static constexpr int version_cache = 2;	   // キャッシュの形式が変わった場合に更新する
+
+	// 画像の配置
+	struct Placement
+	{
+		int idx_page = 0;
+		SDL_Rect rect = {0, 0, 0, 0};
+	};
+
+private:
+	std::vector<SDL_Texture *> page_list;					// ページのテクスチャ
+	std::vector<SDL_Surface *> surface_page_list;			// キャッシュ保存用のページ画像（保存後に解放）
+	std::unordered_map<std::string, Placement> region_pool; // 画像のパスと配置の対応
+
+private:
+	// 高さの順（同じ場合はパスの順）に並べ、行単位で左から配置する
+	bool place(const std::vector<std::string> &path_list, const std::vector<SDL_Surface *> &surface_list)
+	{
+		std::vector<size_t> idx_order_list(path_list.size());
+		for (size_t i = 0; i < idx_order_list.size(); i++)
+			idx_order_list[i] = i;
+		std::sort(idx_order_list.begin(), idx_order_list.end(),
+				  [&](size_t idx_a, size_t idx_b)
+				  {
+					  if (surface_list[idx_a]->h != surface_list[idx_b]->h)
+						  return surface_list[idx_a]->h > surface_list[idx_b]->h;
+					  return path_list[idx_a] < path_list[idx_b];
+				  });
+
+		int idx_page = 0;
+		int x = padding, y = padding, height_shelf = 0;
+		for (size_t idx : idx_order_list)
+		{
+			const SDL_Surface *surface = surface_list[idx];
+
+			// 現在の行に入りきらない場合は次の行へ、ページに入りきらない場合は次のページへ
+			if (x + surface->w + padding > max_size_page)
+			{
+				x = padding;
+				y += height_shelf + padding;
+				height_shelf = 0;
+			}
+			if (y + surface->h + padding > max_size_page)
+			{
+				idx_page++;
+				x = padding, y = padding, height_shelf = 0;
+			}
+
+			Placement &placement = region_pool[path_list[idx]];
+			placement.idx_page = idx_page;
+			placement.rect = {x, y, surface->w, surface->h};
+
+			x += surface->w + padding;
+			height_shelf = std::max(height_shelf, surface->h);
+		}
+
+		return true;
+	}
+
+	// 配置に従って画像をページに書き込み、テクスチャを作成
+	bool blit_page(SDL_Renderer *renderer, const std::vector<std::string> &path_list, const std::vector<SDL_Surface *> &surface_list)
+	{
+		// ページごとに使用している範囲を求め、ページの画像を作成（透明で初期化される）
+		std::vector<SDL_Point> size_page_list;
+		for (const auto &pair : region_pool)
+		{
+			const Placement &placement = pair.second;
+			if (placement.idx_page >= (int)size_page_list.size())
+				size_page_list.resize(placement.idx_page + 1, {0, 0});
+
+			SDL_Point &size_page = size_page_list[placement.idx_page];
+			size_page.x = std::max(size_page.x, placement.rect.x + placement.rect.w + padding);
+			size_page.y = std::max(size_page.y, placement.rect.y + placement.rect.h + padding);
+		}
+
+		for (const SDL_Point &size_page : size_page_list)
+		{
+			SDL_Surface *surface_page = SDL_CreateRGBSurfaceWithFormat(0, size_page.x, size_page.y, 32, SDL_PIXELFORMAT_RGBA32);
+			if (!surface_page)
+				return false;
+			surface_page_list.push_back(surface_page);
+		}
+
+		// アルファ値をそのまま書き込むため、ブレンドせずにコピー
+		for (size_t i = 0; i < path_list.size(); i++)
+		{
+			Placement &placement = region_pool[path_list[i]];
+			SDL_SetSurfaceBlendMode(surface_list[i], SDL_BLENDMODE_NONE);
+			if (SDL_BlitSurface(surface_list[i], nullptr, surface_page_list[placement.idx_page], &placement.rect) != 0)
+				return false;
+		}
+
+		for (SDL_Surface *surface_page : surface_page_list)
+		{
+			SDL_Texture *texture = SDL_CreateTextureFromSurface(renderer, surface_page);
+			if (!texture)
+				return false;
+			SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+			page_list.push_back(texture);
+		}
+
+		return true;
+	}
+
+	// 画像ファイルのサイズと更新日時から、キャッシュの有効性を判断するための文字列を作成（取得できない場合は"-"）
+	// アーカイブ内の画像の場合は、更新日時の代わりに索引のチェックサムを使用する
+	static std::string get_stamp(const std::string &path)
+	{
+		const ArchiveManager::Entry *entry = ArchiveManager::instance()->find_entry(path);
+		if (entry)
+			return "pak:" + std::to_string(entry->size) + ":" + std::to_string(entry->checksum);
+
+		std::error_code error;
+		const auto size_file = std::filesystem::file_size(path, error);
+		if (error)
+			return "-";
+		const auto time_write = std::filesystem::last_write_time(path, error);
+		if (error)
+			return "-";
+
+		return std::to_string(size_file) + ":" + std::to_string(time_write.time_since_epoch().count());
+	}
+
+	// ページ画像と配置情報をキャッシュディレクトリに保存
+	bool save_cache(const std::string &dir_cache)
+	{
+		bool is_saved = true;
+
+		std::error_code error;
+		std::filesystem::create_directories(dir_cache, error);
+		for (size_t i = 0; i < surface_page_list.size() && is_saved; i++)
+			is_saved = DecodeCache::write_image(dir_cache + "/atlas_" + std::to_string(i) + ".img", surface_page_list[i], 0); // ページの有効性は配置情報で判断する
+
+		if (is_saved)
+		{
+			// パスの順に出力し、同じ内容からは同じファイルが作成されるようにする
+			std::vector<std::string> path_list;
+			for (const auto &pair : region_pool)
+				path_list.push_back(pair.first);
+			std::sort(path_list.begin(), path_list.end());
+
+			std::ofstream file(dir_cache + "/atlas.txt");
+			file << "atlas " << version_cache << " " << surface_page_list.size() << "\n";
+			for (const std::string &path : path_list)
+			{
+				const Placement &placement = region_pool[path];
+				file << path << " " << get_stamp(path) << " " << placement.idx_page << " "
+					 << placement.rect.x << " " << placement.rect.y << " " << placement.rect.w << " " << placement.rect.h << "\n";
+			}
+			is_saved = file.good();
+		}
+
+		for (SDL_Surface *surface_page : surface_page_list)
+			SDL_FreeSurface(surface_page);
+		surface_page_list.clear();
+
+		return is_saved;
+	}
+};
+
+#endif // !_TEXTURE_ATLAS_H_
@@ -0,0 +1,13 @@
+#ifndef _TEXTURE_REGION_H_
+#define _TEXTURE_REGION_H_
+
+#include <SDL.h>
+
+/*テクスチャ上の矩形、テクスチャアトラスに詰め込んだ画像の参照に使用*/
+struct TextureRegion
+{
+	SDL_Texture *texture = nullptr;
+	SDL_Rect rect = {0, 0, 0, 0};
+};
+
+#endif // !_TEXTURE_REGION_H_
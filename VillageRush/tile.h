@@ -2,13 +2,17 @@
 #define _TILE_H_
 
 #include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
 
 #define SIZE_TILE 48
 
+// 1タイル分のデータ（6バイト、大きなマップでもメモリ上に密に並ぶようにビットフィールドで詰める）
 struct Tile
 {
 	// 進行方向
-	enum class Direction
+	enum class Direction : uint16_t
 	{
 		None = 0,
 		Up,
@@ -17,14 +21,66 @@ struct Tile
 		Right
 	};
 
-	int terrian = 0;					   // 地形
-	int decoration = -1;				   // 装飾
-	int special_flag = -1;				   // 特殊フラグ（防御ポイント、モンスター出現ポイントなど）
-	Direction direction = Direction::None; // 方向マーカー
+	// 特殊フラグの範囲（12ビットの符号付き整数）
+	static constexpr int max_special_flag = 2047;
 
-	bool has_tower = false; // 現在の位置に防御タワーが存在するかどうかを記録するためのフラグ
+	Tile() : direction(Direction::None), special_flag(-1) {}
+
+	uint16_t terrian = 0;	 // 地形
+	int16_t decoration = -1; // 装飾
+	Direction direction : 4; // 方向マーカー
+	int16_t special_flag : 12; // 特殊フラグ（防御ポイント、モンスター出現ポイントなど）
 };
 
-typedef std::vector<std::vector<Tile>> TileMap; // TileMapという名前の2次元配列を定義
+/*
+ * タイルマップ（行優先で1つの配列に格納した2次元のタイル）
+ * 防御塔の設置状況はタイルとは別に Map が保持する
+ */
+class TileMap
+{
+public:
+	TileMap() = default;
+	TileMap(size_t width, size_t height) : width(width), height(height), tile_list(width * height) {}
+	// 行優先のタイルの配列から作成（要素数は width * height であること）
+	TileMap(size_t width, size_t height, std::vector<Tile> &&tile_list) : width(width), height(height), tile_list(std::move(tile_list)) {}
+	~TileMap() = default;
+
+	size_t get_width() const
+	{
+		return width;
+	}
+
+	size_t get_height() const
+	{
+		return height;
+	}
+
+	bool empty() const
+	{
+		return tile_list.empty();
+	}
+
+	// 指定した列（x）と行（y）のタイルを取得（範囲のチェックは呼び出し側で行う）
+	Tile &get_tile(int x, int y)
+	{
+		return tile_list[(size_t)y * width + x];
+	}
+
+	const Tile &get_tile(int x, int y) const
+	{
+		return tile_list[(size_t)y * width + x];
+	}
+
+	// すべてのタイル（行優先）
+	const std::vector<Tile> &get_tile_list() const
+	{
+		return tile_list;
+	}
+
+private:
+	size_t width = 0;
+	size_t height = 0;
+	std::vector<Tile> tile_list;
+};
 
 #endif // !_TILE_H_
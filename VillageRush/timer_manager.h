@@ -0,0 +1,337 @@
+#ifndef _TIMER_MANAGER_H_
+#define _TIMER_MANAGER_H_
+
+/**
+ * @brief タイマー管理クラス
+ *
+ * このクラスは、ゲームワールド内のエンティティ（敵、防御塔、コインなど）のタイマーをまとめて管理するシングルトンクラスです。
+ * 各タイマーは期限（ワールド時間）を登録し、期限の早い順に並べた優先度付きキュー（最小ヒープ）で管理します。
+ * 毎刻みの処理は期限に達したタイマーだけで行うため、待機中のタイマーの数が増えても処理時間は増えません。
+ *
+ * 主な機能:
+ * - 一回のみ／繰り返しのタイマーの登録と再起動、停止
+ * - タイマーごとの一時停止と再開
+ * - ワールド全体の時間の倍率（タイムスケール）
+ *
+ * 使用方法:
+ * - エンティティは WorldTimer をメンバーとして持ち、Timer と同じように設定する（on_update() の呼び出しは不要）
+ * - TimerManager::instance()->on_update() を毎刻み、ワールドの更新の先頭で呼び出す
+ *
+ * 注意事項:
+ * - タイマーは restart() を呼び出すまで動作しません
+ * - 同じ刻みに期限に達したタイマーは期限の早い順（同じ場合は登録順）にコールバックが呼び出されます
+ * - コールバック内で再起動したタイマーは、次の刻みから期限を判定します（1刻みに同じタイマーが2回以上発動しない）
+ */
+
+#include "manager.h"
+#include "profile_manager.h"
+
+#include <SDL.h>
+#include <vector>
+#include <functional>
+#include <algorithm>
+
+class TimerManager : public Manager<TimerManager>
+{
+	friend class Manager<TimerManager>;
+
+public:
+	typedef int TimerId;					  // タイマーの番号（登録順ではなく、空き番号を再利用）
+	typedef std::function<void()> Callback; // タイムアウト時のコールバック関数
+
+public:
+	// タイマーを登録（停止状態）
+	TimerId create_timer()
+	{
+		TimerId id = -1;
+		if (!free_id_list.empty())
+		{
+			id = free_id_list.back();
+			free_id_list.pop_back();
+		}
+		else
+		{
+			id = (TimerId)slot_list.size();
+			slot_list.emplace_back();
+		}
+
+		slot_list[id] = Slot();
+		return id;
+	}
+
+	// タイマーの登録を解除
+	void destroy_timer(TimerId id)
+	{
+		slot_list[id] = Slot(); // キューに残っている期限は登録時の番号と一致しなくなるため無視される
+		free_id_list.push_back(id);
+	}
+
+	void set_wait_time(TimerId id, double val)
+	{
+		Slot &slot = slot_list[id];
+		slot.wait_time = val;
+		if (slot.is_active && !slot.is_paused)
+			schedule(id);
+	}
+
+	void set_one_shot(TimerId id, bool flag)
+	{
+		slot_list[id].one_shot = flag;
+	}
+
+	void set_on_timeout(TimerId id, Callback on_timeout)
+	{
+		slot_list[id].on_timeout = on_timeout;
+	}
+
+	// 現在の時間から計測を開始（一時停止も解除）
+	void restart(TimerId id)
+	{
+		Slot &slot = slot_list[id];
+		slot.time_start = time_world;
+		slot.is_active = true;
+		slot.is_paused = false;
+		schedule(id);
+	}
+
+	// タイマーを停止（restart() を呼び出すまで発動しない）
+	void stop(TimerId id)
+	{
+		Slot &slot = slot_list[id];
+		slot.is_active = false;
+		slot.version = next_version();
+	}
+
+	// タイマーを一時停止（経過時間を保存）
+	void pause(TimerId id)
+	{
+		Slot &slot = slot_list[id];
+		if (!slot.is_active || slot.is_paused)
+			return;
+
+		slot.is_paused = true;
+		slot.pass_time_paused = time_world - slot.time_start;
+		slot.version = next_version();
+	}
+
+	// タイマーを再開（一時停止した時点の経過時間から計測を続ける）
+	void resume(TimerId id)
+	{
+		Slot &slot = slot_list[id];
+		if (!slot.is_active || !slot.is_paused)
+			return;
+
+		slot.is_paused = false;
+		slot.time_start = time_world - slot.pass_time_paused;
+		schedule(id);
+	}
+
+	// タイマーが動作中（期限待ち）かどうか
+	bool check_active(TimerId id) const
+	{
+		const Slot &slot = slot_list[id];
+		return slot.is_active && !slot.is_paused;
+	}
+
+	// ワールド時間を進め、期限に達したタイマーのコールバックを呼び出す
+	void on_update(double delta)
+	{
+		PROFILE_ZONE("TimerManager::on_update");
+
+		time_world += delta * time_scale;
+
+		// コールバック内での再起動は次の刻みから判定するため、キューへの追加を保留する
+		is_updating = true;
+		while (!schedule_queue.empty() && schedule_queue.front().deadline <= time_world)
+		{
+			std::pop_heap(schedule_queue.begin(), schedule_queue.end(), compare_schedule);
+			const Schedule schedule_due = schedule_queue.back();
+			schedule_queue.pop_back();
+
+			// 登録後に再起動・停止・一時停止されたタイマーの古い期限は無視
+			Slot &slot = slot_list[schedule_due.id];
+			if (schedule_due.version != slot.version)
+				continue;
+
+			// 繰り返しの場合は次の周期の計測を開始し、一回のみの場合は停止
+			if (slot.one_shot)
+			{
+				slot.is_active = false;
+				slot.version = next_version();
+			}
+			else
+			{
+				slot.time_start += slot.wait_time;
+				schedule(schedule_due.id);
+			}
+
+			// コールバック内でタイマーが登録されてリストが再確保される場合に備え、コピーしてから呼び出す
+			const Callback on_timeout = slot.on_timeout;
+			if (on_timeout)
+				on_timeout();
+		}
+		is_updating = false;
+
+		for (const Schedule &schedule_pending : schedule_pending_list)
+			push_schedule(schedule_pending);
+		schedule_pending_list.clear();
+
+		PROFILE_COUNTER("TimerManager::num_scheduled", schedule_queue.size());
+	}
+
+	// ワールド時間の倍率（1で通常の速さ、0で停止）
+	void set_time_scale(double val)
+	{
+		time_scale = val;
+	}
+
+	double get_time_scale() const
+	{
+		return time_scale;
+	}
+
+	// ワールド時間（タイムスケール適用後の経過時間）
+	double get_time_world() const
+	{
+		return time_world;
+	}
+
+protected:
+	TimerManager() = default;
+	~TimerManager() = default;
+
+private:
+	// タイマーごとの状態
+	struct Slot
+	{
+		Callback on_timeout;
+		double wait_time = 0;		 // 待機時間
+		double time_start = 0;		 // 計測を開始したワールド時間
+		double pass_time_paused = 0; // 一時停止した時点の経過時間
+		Uint64 version = 0;			 // 期限の登録ごとに更新し、古い期限を判別する
+		bool one_shot = false;
+		bool is_active = false;
+		bool is_paused = false;
+	};
+
+	// キューに登録する期限
+	struct Schedule
+	{
+		double deadline = 0;
+		Uint64 version = 0; // 登録順（同じ期限の場合の順序にも使用）
+		TimerId id = -1;
+	};
+
+private:
+	double time_world = 0;
+	double time_scale = 1;
+
+	std::vector<Slot> slot_list;
+	std::vector<TimerId> free_id_list;
+
+	std::vector<Schedule> schedule_queue; // 期限の早い順の最小ヒープ
+	std::vector<Schedule> schedule_pending_list;
+	bool is_updating = false;
+	Uint64 num_version = 0;
+
+private:
+	Uint64 next_version()
+	{
+		return ++num_version;
+	}
+
+	// タイマーの期限を（再）登録し、それまでの期限を無効にする
+	void schedule(TimerId id)
+	{
+		Slot &slot = slot_list[id];
+		slot.version = next_version();
+
+		Schedule schedule_new;
+		schedule_new.deadline = slot.time_start + slot.wait_time;
+		schedule_new.version = slot.version;
+		schedule_new.id = id;
+
+		if (is_updating)
+			schedule_pending_list.push_back(schedule_new);
+		else
+			push_schedule(schedule_new);
+	}
+
+	void push_schedule(const Schedule &schedule_new)
+	{
+		schedule_queue.push_back(schedule_new);
+		std::push_heap(schedule_queue.begin(), schedule_queue.end(), compare_schedule);
+	}
+
+	// std::push_heap / pop_heap は最大ヒープのため、期限（と登録順）の比較を逆にする
+	static bool compare_schedule(const Schedule &schedule_a, const Schedule &schedule_b)
+	{
+		if (schedule_a.deadline != schedule_b.deadline)
+			return schedule_a.deadline > schedule_b.deadline;
+		return schedule_a.version > schedule_b.version;
+	}
+};
+
+/*TimerManager に登録するタイマー、Timer と同じ設定方法で使用する（破棄時に登録を解除）*/
+class WorldTimer
+{
+public:
+	WorldTimer()
+	{
+		timer_manager = TimerManager::instance();
+		id = timer_manager->create_timer();
+	}
+	~WorldTimer()
+	{
+		timer_manager->destroy_timer(id);
+	}
+
+	WorldTimer(const WorldTimer &) = delete;
+	WorldTimer &operator=(const WorldTimer &) = delete;
+
+	void restart()
+	{
+		timer_manager->restart(id);
+	}
+
+	void stop()
+	{
+		timer_manager->stop(id);
+	}
+
+	void set_wait_time(double val)
+	{
+		timer_manager->set_wait_time(id, val);
+	}
+
+	void set_one_shot(bool flag)
+	{
+		timer_manager->set_one_shot(id, flag);
+	}
+
+	void set_on_timeout(TimerManager::Callback on_timeout)
+	{
+		timer_manager->set_on_timeout(id, on_timeout);
+	}
+
+	void pause()
+	{
+		timer_manager->pause(id);
+	}
+
+	void resume()
+	{
+		timer_manager->resume(id);
+	}
+
+	bool check_active() const
+	{
+		return timer_manager->check_active(id);
+	}
+
+private:
+	TimerManager *timer_manager = nullptr;
+	TimerManager::TimerId id = -1;
+};
+
+#endif // !_TIMER_MANAGER_H_
@@ -8,7 +8,7 @@
  *
  * 主な機能:
  * - 防御塔の位置、向き、攻撃範囲の管理
- * - 敵の検出と攻撃
+ * - 敵の検出と攻撃（射撃のたびに視野範囲内で最も進行度の高い敵を目標とする）
  * - アニメーション（アイドル状態と攻撃状態）の制御
  * - 攻撃のクールダウン管理
  * - レベルアップと能力値の更新
@@ -33,7 +33,9 @@
 #include "config_manager.h"
 #include "resources_manager.h"
 #include "enemy_manager.h"
-#include "timer.h"
+#include "random_manager.h"
+#include "timer_manager.h"
+#include "profile_manager.h"
 
 #include <SDL.h>
 
@@ -49,55 +51,9 @@ public:
 			{
 				can_fire = true; // タイマーがタイムアウトしたら、射撃を許可
 			});
-
-		// 各方向のアイドルアニメーションを設定（上下左右）
-		anim_idle_up.set_loop(true);
-		anim_idle_up.set_interval(0.2); // 各フレームの時間を0.2秒に設定
-
-		anim_idle_down.set_loop(true);
-		anim_idle_down.set_interval(0.2);
-
-		anim_idle_left.set_loop(true);
-		anim_idle_left.set_interval(0.2);
-
-		anim_idle_right.set_loop(true);
-		anim_idle_right.set_interval(0.2);
-
-		// 各方向の射撃アニメーションを設定（上下左右）
-		anim_fire_up.set_loop(false); // 射撃アニメーションはループしない
-		anim_fire_up.set_interval(0.2);
-		anim_fire_up.set_on_finished(
-			[&]()
-			{
-				update_idle_animation(); // 射撃アニメーション完了後、アイドルアニメーションに戻る
-			});
-
-		anim_fire_down.set_loop(false);
-		anim_fire_down.set_interval(0.2);
-		anim_fire_down.set_on_finished(
-			[&]()
-			{
-				update_idle_animation();
-			});
-
-		anim_fire_left.set_loop(false);
-		anim_fire_left.set_interval(0.2);
-		anim_fire_left.set_on_finished(
-			[&]()
-			{
-				update_idle_animation();
-			});
-
-		anim_fire_right.set_loop(false);
-		anim_fire_right.set_interval(0.2);
-		anim_fire_right.set_on_finished(
-			[&]()
-			{
-				update_idle_animation();
-			});
 	};
 
-	~Tower() = default;
+	virtual ~Tower() = default;
 
 	void set_position(const Vector2 &position)
 	{
@@ -114,11 +70,15 @@ public:
 		return position;
 	}
 
-	// フレームごとの更新関数、タイマーとアニメーションの更新を処理
+	// フレームごとの更新関数、アニメーションの更新と射撃を処理（射撃タイマーは TimerManager が処理）
 	void on_update(double delta)
 	{
-		timer_fire.on_update(delta);	// 射撃タイマーを更新
-		anim_current->on_update(delta); // 現在のアニメーションを更新
+		anim.on_update(delta); // 現在のアニメーションを更新
+
+		if (anim.check_finished()) // 射撃アニメーション完了後、アイドルアニメーションに戻る
+		{
+			update_idle_animation();
+		}
 
 		if (can_fire) // 射撃可能な場合、射撃ロジックを呼び出す
 		{
@@ -129,28 +89,54 @@ public:
 	// 防御塔を画面にレンダリング
 	void on_render(SDL_Renderer *renderer)
 	{
-		static SDL_Point point;
+		static thread_local SDL_Point point;
 		point.x = (int)(position.x - size.x / 2);
 		point.y = (int)(position.y - size.y / 2);
 
-		anim_current->on_render(renderer, point);
+		anim.on_render(point);
 	}
 
+public:
+	// 防御塔の種類ごとのアニメーションクリップ（継承先の create_clip_set() で作成して TowerManager が保持し、同じ種類の防御塔で共有）
+	struct ClipSet
+	{
+		// アイドルアニメーション（ループする）
+		AnimationClip idle_up;
+		AnimationClip idle_down;
+		AnimationClip idle_left;
+		AnimationClip idle_right;
+
+		// 射撃アニメーション（ループしない）
+		AnimationClip fire_up;
+		AnimationClip fire_down;
+		AnimationClip fire_left;
+		AnimationClip fire_right;
+
+		ClipSet()
+		{
+			for (AnimationClip *clip : {&idle_up, &idle_down, &idle_left, &idle_right})
+			{
+				clip->set_loop(true);
+				clip->set_interval(0.2); // 各フレームの時間を0.2秒に設定
+			}
+			for (AnimationClip *clip : {&fire_up, &fire_down, &fire_left, &fire_right})
+			{
+				clip->set_loop(false); // 射撃アニメーションはループしない
+				clip->set_interval(0.2);
+			}
+		}
+	};
+
 protected:
 	// 防御塔のサイズ
 	Vector2 size;
 
-	// 防御塔のアイドルアニメーション
-	Animation anim_idle_up;
-	Animation anim_idle_down;
-	Animation anim_idle_left;
-	Animation anim_idle_right;
-
-	// 防御塔の射撃アニメーション
-	Animation anim_fire_up;
-	Animation anim_fire_down;
-	Animation anim_fire_left;
-	Animation anim_fire_right;
+	// アニメーションクリップを設定し、右向きのアイドルアニメーションから再生（継承先のコンストラクタで呼び出す）
+	void set_clip_set(const ClipSet *clip_set)
+	{
+		this->clip_set = clip_set;
+		anim.play(&clip_set->idle_right);
+	}
 
 	// 防御塔のタイプ、デフォルトは弓兵
 	TowerType tower_type = TowerType::Archer;
@@ -162,61 +148,64 @@ protected:
 	BulletType bullet_type = BulletType::Arrow;
 
 private:
-	Timer timer_fire;							// 射撃タイマー
+	WorldTimer timer_fire;						// 射撃タイマー
 	Vector2 position;							// 防御塔の位置
 	bool can_fire = true;						// 射撃可能かどうかを制御
 	Facing facing = Facing::Right;				// 防御塔の向き、デフォルトは右向き
-	Animation *anim_current = &anim_idle_right; // 防御塔の現在のアニメーション、デフォルトは右向きのアイドルアニメーション
+	const ClipSet *clip_set = nullptr;			// 防御塔の種類のアニメーションクリップ
+	Animation anim;								// 防御塔の現在のアニメーション
 
 private:
-	// 現在の防御塔の向きに基づいてアイドルアニメーションを切り替え
+	// 現在の防御塔の向きに基づいてアイドルアニメーションを最初から再生
 	void update_idle_animation()
 	{
 		switch (facing)
 		{
 		case Left:
-			anim_current = &anim_idle_left;
+			anim.play(&clip_set->idle_left);
 			break;
 		case Right:
-			anim_current = &anim_idle_right;
+			anim.play(&clip_set->idle_right);
 			break;
 		case Up:
-			anim_current = &anim_idle_up;
+			anim.play(&clip_set->idle_up);
 			break;
 		case Down:
-			anim_current = &anim_idle_down;
+			anim.play(&clip_set->idle_down);
 			break;
 		}
 	}
 
-	// 現在の防御塔の向きに基づいて射撃アニメーションを切り替え
+	// 現在の防御塔の向きに基づいて射撃アニメーションを最初から再生
 	void update_fire_animation()
 	{
 		switch (facing)
 		{
 		case Left:
-			anim_current = &anim_fire_left;
+			anim.play(&clip_set->fire_left);
 			break;
 		case Right:
-			anim_current = &anim_fire_right;
+			anim.play(&clip_set->fire_right);
 			break;
 		case Up:
-			anim_current = &anim_fire_up;
+			anim.play(&clip_set->fire_up);
 			break;
 		case Down:
-			anim_current = &anim_fire_down;
+			anim.play(&clip_set->fire_down);
 			break;
 		}
 	}
 	// 敵の探索: 攻撃視野範囲内で最も進行度の高い敵を目標として攻撃
 	Enemy *find_target_enemy()
 	{
+		PROFILE_ZONE("Tower::find_target_enemy");
+
 		double process = -1;		   // 最も進行度の高い敵の進行度を記録
 		double view_range = 0;		   // 視野範囲を初期化
 		Enemy *enemy_target = nullptr; // 見つかった目標敵を格納
 
 		// 設定マネージャーのインスタンスを取得し、異なる防御塔の設定を取得するために使用
-		static ConfigManager *instance = ConfigManager::instance();
+		ConfigManager *instance = ConfigManager::instance();
 
 		// 防御塔のタイプに応じて、対応するレベルの攻撃視野範囲を取得
 		switch (tower_type)
@@ -232,23 +221,20 @@ private:
 			break;
 		}
 
-		// 敵マネージャーから敵リストを取得
-		EnemyManager::EnemyList &enemy_list = EnemyManager::instance()->get_enemy_list();
+		// 敵マネージャーの空間グリッドから、視野範囲内にいる敵を検索
+		static thread_local EnemyManager::EnemyList enemy_in_range_list;
+		EnemyManager::instance()->get_enemy_grid().query_radius(position, view_range * SIZE_TILE, enemy_in_range_list);
 
-		// すべての敵をループ
-		for (Enemy *enemy : enemy_list)
+		// 視野範囲内のすべての敵をループ
+		for (Enemy *enemy : enemy_in_range_list)
 		{
-			// 敵と防御塔の距離が視野範囲内かどうかを判断
-			if ((enemy->get_position() - position).length() <= view_range * SIZE_TILE)
+			// その敵の経路上の進行度を取得
+			double new_process = enemy->get_route_process();
+			// その敵の進行度が現在記録されている最大進行度より大きい場合、目標敵を更新
+			if (new_process > process)
 			{
-				// その敵の経路上の進行度を取得
-				double new_process = enemy->get_route_process();
-				// その敵の進行度が現在記録されている最大進行度より大きい場合、目標敵を更新
-				if (new_process > process)
-				{
-					enemy_target = enemy;
-					process = new_process;
-				}
+				enemy_target = enemy;
+				process = new_process;
 			}
 		}
 		// 見つかった目標敵を返す（条件に合う敵がいない場合はnullptrを返す）
@@ -267,9 +253,11 @@ private:
 		// 射撃不可に設定
 		can_fire = false;
 		// 設定ファイルを取得
-		static ConfigManager *instance = ConfigManager::instance();
+		ConfigManager *instance = ConfigManager::instance();
 		// 効果音ファイルを取得
-		static const ResourcesManager::SoundPool &sound_pool = ResourcesManager::instance()->get_sound_pool();
+		const ResourcesManager *resources_manager = ResourcesManager::instance();
+		// 演出用の乱数（効果音の選択）
+		RandomManager *random_manager = RandomManager::instance();
 
 		// 属性を初期化：射撃間隔、ダメージ
 		double interval = 0, damage = 0;
@@ -279,13 +267,13 @@ private:
 		case Archer:
 			interval = instance->archer_template.interval[instance->level_archer];
 			damage = instance->archer_template.damage[instance->level_archer];
-			switch (rand() % 2)
+			switch (random_manager->cosmetic_int(2))
 			{
 			case 0:
-				Mix_PlayChannel(-1, sound_pool.find(ResID::Sound_ArrowFire_1)->second, 0);
+				resources_manager->play_sound(ResID::Sound_ArrowFire_1);
 				break;
 			case 1:
-				Mix_PlayChannel(-1, sound_pool.find(ResID::Sound_ArrowFire_2)->second, 0);
+				resources_manager->play_sound(ResID::Sound_ArrowFire_2);
 				break;
 			}
 			break;
@@ -293,13 +281,13 @@ private:
 		case Axeman:
 			interval = instance->axeman_template.interval[instance->level_axeman];
 			damage = instance->axeman_template.damage[instance->level_axeman];
-			Mix_PlayChannel(-1, sound_pool.find(ResID::Sound_AxeFire)->second, 0);
+			resources_manager->play_sound(ResID::Sound_AxeFire);
 			break;
 
 		case Gunner:
 			interval = instance->gunner_template.interval[instance->level_gunner];
 			damage = instance->gunner_template.damage[instance->level_gunner];
-			Mix_PlayChannel(-1, sound_pool.find(ResID::Sound_ShellFire)->second, 0);
+			resources_manager->play_sound(ResID::Sound_ShellFire);
 			break;
 		}
 
@@ -325,9 +313,8 @@ private:
 			facing = direction.y > 0 ? Facing::Down : Facing::Up;
 		}
 
-		// 射撃アニメーションを更新してリセット
+		// 射撃アニメーションを最初から再生
 		update_fire_animation();
-		anim_current->reset();
 	}
 };
 
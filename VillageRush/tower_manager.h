@@ -26,6 +26,8 @@
 #include "gunner_tower.h"
 #include "config_manager.h"
 #include "resources_manager.h"
+#include "profile_manager.h"
+#include "sprite_batch_manager.h"
 
 #include <vector>
 
@@ -33,10 +35,16 @@ class TowerManager : public Manager<TowerManager>
 {
 	friend class Manager<TowerManager>;
 
+public:
+	// 防御塔のリストの型定義
+	typedef std::vector<Tower *> TowerList;
+
 public:
 	// すべての防御塔の状態を更新する
 	void on_update(double delta)
 	{
+		PROFILE_ZONE("TowerManager::on_update");
+
 		for (Tower *tower : tower_list)
 			tower->on_update(delta);
 	}
@@ -44,14 +52,19 @@ public:
 	// すべての防御塔を描画する
 	void on_render(SDL_Renderer *renderer)
 	{
+		PROFILE_ZONE("TowerManager::on_render");
+
 		for (Tower *tower : tower_list)
 			tower->on_render(renderer);
+
+		// 種類（テクスチャ）ごとにまとめて描画
+		SpriteBatchManager::instance()->flush(renderer);
 	}
 
 	// 防御塔の設置コストを取得する
 	double get_place_cost(TowerType type)
 	{
-		static ConfigManager *instance = ConfigManager::instance();
+		ConfigManager *instance = ConfigManager::instance();
 
 		switch (type)
 		{
@@ -71,7 +84,7 @@ public:
 	// 防御塔のアップグレードコストを取得する
 	double get_upgrade_cost(TowerType type)
 	{
-		static ConfigManager *instance = ConfigManager::instance();
+		ConfigManager *instance = ConfigManager::instance();
 
 		// 塔のタイプに応じて適切なアップグレードコストを返す
 		switch (type)
@@ -93,7 +106,7 @@ public:
 	// 防御塔の視野範囲を取得する
 	double get_view_range(TowerType type)
 	{
-		static ConfigManager *instance = ConfigManager::instance();
+		ConfigManager *instance = ConfigManager::instance();
 
 		// 塔のタイプとレベルに応じて適切な視野範囲を返す
 		switch (type)
@@ -122,22 +135,22 @@ public:
 		switch (type)
 		{
 		case Archer:
-			tower = new ArcherTower();
+			tower = new ArcherTower(&clip_set_archer);
 			break;
 		case Axeman:
-			tower = new AxemanTower();
+			tower = new AxemanTower(&clip_set_axeman);
 			break;
 		case Gunner:
-			tower = new GunnerTower();
+			tower = new GunnerTower(&clip_set_gunner);
 			break;
 		default:
-			tower = new ArcherTower();
+			tower = new ArcherTower(&clip_set_archer);
 			break;
 		}
 
 		// 防御塔の設置位置を計算
-		static Vector2 position;
-		static const SDL_Rect &rect = ConfigManager::instance()->rect_tile_map;
+		static thread_local Vector2 position;
+		const SDL_Rect &rect = ConfigManager::instance()->rect_tile_map;
 
 		position.x = rect.x + idx.x * SIZE_TILE + SIZE_TILE / 2;
 		position.y = rect.y + idx.y * SIZE_TILE + SIZE_TILE / 2;
@@ -148,14 +161,19 @@ public:
 		ConfigManager::instance()->map.place_tower(idx); // マップ上で防御塔の位置をマーク
 
 		// 設置音を再生
-		static const ResourcesManager::SoundPool &sound_pool = ResourcesManager::instance()->get_sound_pool();
-		Mix_PlayChannel(-1, sound_pool.find(ResID::Sound_PlaceTower)->second, 0);
+		const ResourcesManager *resources_manager = ResourcesManager::instance();
+		resources_manager->play_sound(ResID::Sound_PlaceTower);
+	}
+
+	TowerList &get_tower_list()
+	{
+		return tower_list;
 	}
 
 	// 指定されたタイプの防御塔をアップグレードする
 	void upgrade_tower(TowerType type)
 	{
-		static ConfigManager *instance = ConfigManager::instance();
+		ConfigManager *instance = ConfigManager::instance();
 
 		// タイプに応じて防御塔のレベルを上げる（最大9レベルまで）
 		switch (type)
@@ -172,15 +190,33 @@ public:
 		}
 
 		// アップグレード音を再生
-		static const ResourcesManager::SoundPool &sound_pool = ResourcesManager::instance()->get_sound_pool();
-		Mix_PlayChannel(-1, sound_pool.find(ResID::Sound_TowerLevelUp)->second, 0);
+		const ResourcesManager *resources_manager = ResourcesManager::instance();
+		resources_manager->play_sound(ResID::Sound_TowerLevelUp);
 	}
 
 protected:
-	TowerManager() = default;
-	~TowerManager() = default;
+	// 防御塔の種類ごとのアニメーションクリップを作成（リソースの読み込み後、最初の設置より前に一度だけ）
+	TowerManager()
+		: clip_set_archer(ArcherTower::create_clip_set()),
+		  clip_set_axeman(AxemanTower::create_clip_set()),
+		  clip_set_gunner(GunnerTower::create_clip_set())
+	{
+	}
+
+	~TowerManager()
+	{
+		for (Tower *tower : tower_list)
+		{
+			delete tower;
+		}
+	}
 
 private:
-	std::vector<Tower *> tower_list;
+	TowerList tower_list;
+
+	// 防御塔の種類ごとのアニメーションクリップ（同じ種類のすべての防御塔で共有）
+	const Tower::ClipSet clip_set_archer;
+	const Tower::ClipSet clip_set_axeman;
+	const Tower::ClipSet clip_set_gunner;
 };
 #endif // !_TOWER_MANAGER_H_
@@ -12,13 +12,13 @@ public:
 	UpgradePanel()
 	{
 		// リソースマネージャーのテクスチャプールを取得
-		const ResourcesManager::TexturePool &texture_pool = ResourcesManager::instance()->get_texture_pool();
+		const ResourcesManager *resources_manager = ResourcesManager::instance();
 
 		// テクスチャプールから異なる状態のテクスチャリソースを取得
-		tex_idle = texture_pool.find(ResID::Tex_UIUpgradeIdle)->second;
-		tex_hovered_top = texture_pool.find(ResID::Tex_UIUpgradeHoveredTop)->second;
-		tex_hovered_left = texture_pool.find(ResID::Tex_UIUpgradeHoveredLeft)->second;
-		tex_hovered_right = texture_pool.find(ResID::Tex_UIUpgradeHoveredRight)->second;
+		tex_idle = resources_manager->find_texture(ResID::Tex_UIUpgradeIdle);
+		tex_hovered_top = resources_manager->find_texture(ResID::Tex_UIUpgradeHoveredTop);
+		tex_hovered_left = resources_manager->find_texture(ResID::Tex_UIUpgradeHoveredLeft);
+		tex_hovered_right = resources_manager->find_texture(ResID::Tex_UIUpgradeHoveredRight);
 	};
 	~UpgradePanel() = default;
 
@@ -26,7 +26,7 @@ public:
 	void on_update(SDL_Renderer *renderer)
 	{
 		// TowerManagerのシングルトンを取得、防御塔のアップグレードコストを取得するために使用
-		static TowerManager *instance = TowerManager::instance();
+		TowerManager *instance = TowerManager::instance();
 
 		// 3つの異なるタワータイプのアップグレードコストを更新
 		val_top = (int)instance->get_upgrade_cost(TowerType::Axeman);
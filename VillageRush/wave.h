@@ -1,8 +1,6 @@
 #ifndef _WAVE_H_
 #define _WAVE_H_
 
-#include "enemy_type.h"
-
 #include <vector>
 
 struct Wave
@@ -12,7 +10,7 @@ struct Wave
 	{
 		double interval = 0;
 		int spawn_point = 1;
-		EnemyType enemy_type = EnemyType::Slim;
+		int enemy_type = 0; // 敵の種類（ConfigManager::enemy_template_list のインデックス）
 	};
 
 	// その他のデータ
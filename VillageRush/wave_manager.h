@@ -31,6 +31,7 @@
 #include "config_manager.h"
 #include "enemy_manager.h"
 #include "coin_manager.h"
+#include "profile_manager.h"
 
 /* 波管理クラス、敵の波の生成と管理を制御するためのクラス */
 class WaveManager : public Manager<WaveManager>
@@ -41,8 +42,10 @@ public:
 	/* 各フレームの更新、波の進行と敵の生成を処理する */
 	void on_update(double delta)
 	{
+		PROFILE_ZONE("WaveManager::on_update");
+
 		// 設定マネージャーのインスタンスを取得
-		static ConfigManager *instance = ConfigManager::instance();
+		ConfigManager *instance = ConfigManager::instance();
 
 		// ゲームが終了している場合、即座に戻る
 		if (instance->is_game_over)
@@ -86,7 +89,7 @@ protected:
 	WaveManager()
 	{
 		// 設定マネージャーから波リストを取得
-		static const std::vector<Wave> &wave_list = ConfigManager::instance()->wave_list;
+		const std::vector<Wave> &wave_list = ConfigManager::instance()->wave_list;
 
 		// 波開始タイマーを設定、一度だけトリガー
 		timer_start_wave.set_one_shot(true);